@@ -0,0 +1,133 @@
+#pragma once
+#include <atomic>
+#include <cstdint>
+#include <limits>
+#include <optional>
+#include <type_traits>
+#include "cbi/bounded.h"
+
+namespace cbi
+{
+	// Lock-free Bounded value whose updates never leave [lower_bound(), upper_bound()].
+	// The offset from the lower bound is stored in the narrowest unsigned atomic that holds width().
+	template <bounded B, overflow_policy Policy = overflow_policy::saturate>
+	class atomic
+	{
+		static constexpr std::uintmax_t width = details::unsigned_width(B::lower_bound(), B::upper_bound());
+
+	public:
+		using value_type = B;
+		using storage_type = details::least_unsigned_t<width>;
+		// rejected updates report failure as std::nullopt
+		using result_type = std::conditional_t<Policy == overflow_policy::reject, std::optional<B>, B>;
+
+		static_assert(std::atomic<storage_type>::is_always_lock_free);
+		static constexpr bool is_always_lock_free = true;
+
+		// A domain of 2^k values wraps on its own inside the 2^n values of the storage,
+		// so wrapping updates are a plain fetch_add and the offset is masked on every read.
+		static constexpr bool native_wrap = Policy == overflow_policy::wrap && (width & (width + 1)) == 0;
+
+		constexpr explicit atomic(const B initial) noexcept : offset(to_offset(initial)) {}
+		atomic(const atomic&) = delete;
+		atomic& operator=(const atomic&) = delete;
+
+		[[nodiscard]] B load(const std::memory_order order = std::memory_order_seq_cst) const noexcept
+		{
+			return from_offset(offset.load(order));
+		}
+
+		void store(const B value, const std::memory_order order = std::memory_order_seq_cst) noexcept
+		{
+			offset.store(to_offset(value), order);
+		}
+
+		B exchange(const B value, const std::memory_order order = std::memory_order_seq_cst) noexcept
+		{
+			return from_offset(offset.exchange(to_offset(value), order));
+		}
+
+		bool compare_exchange_strong(B& expected, const B desired,
+			const std::memory_order order = std::memory_order_seq_cst) noexcept
+		{
+			if constexpr (native_wrap)
+			{
+				// the stored offset may carry bits above the mask, compare on the masked value
+				storage_type current = offset.load(std::memory_order_relaxed);
+				while ((current & mask) == to_offset(expected))
+				{
+					if (offset.compare_exchange_weak(current, to_offset(desired), order, std::memory_order_relaxed))
+						return true;
+				}
+				expected = from_offset(current);
+				return false;
+			}
+			else
+			{
+				storage_type current = to_offset(expected);
+				if (offset.compare_exchange_strong(current, to_offset(desired), order, std::memory_order_relaxed))
+					return true;
+				expected = from_offset(current);
+				return false;
+			}
+		}
+
+		// Returns the value before the update.
+		template <bounded D>
+		result_type fetch_add(const D delta, const std::memory_order order = std::memory_order_seq_cst) noexcept
+		{
+			return update(details::magnitude_of(delta.get()), delta.get() < 0, order);
+		}
+
+		template <bounded D>
+		result_type fetch_sub(const D delta, const std::memory_order order = std::memory_order_seq_cst) noexcept
+		{
+			return update(details::magnitude_of(delta.get()), delta.get() > 0, order);
+		}
+
+	private:
+		static constexpr storage_type mask = static_cast<storage_type>(width);
+
+		[[nodiscard]] static constexpr storage_type to_offset(const B value) noexcept
+		{
+			return static_cast<storage_type>(details::offset_from(value.get(), B::lower_bound()));
+		}
+
+		[[nodiscard]] static constexpr B from_offset(const storage_type raw) noexcept
+		{
+			if constexpr (native_wrap)
+				return details::from_offset<B>(raw & mask);
+			else
+				return details::from_offset<B>(raw);
+		}
+
+		result_type update(const std::uintmax_t magnitude, const bool negative, const std::memory_order order) noexcept
+		{
+			if constexpr (native_wrap)
+			{
+				const auto step = static_cast<storage_type>(negative ? 0 - magnitude : magnitude);
+				return from_offset(offset.fetch_add(step, order));
+			}
+			else
+			{
+				storage_type current = offset.load(std::memory_order_relaxed);
+				for (;;)
+				{
+					const auto next = details::policy_step<Policy>(current, width, magnitude, negative);
+					if constexpr (Policy == overflow_policy::reject)
+					{
+						if (!next) return std::nullopt;
+					}
+					// nothing changes (e.g. already saturated), don't dirty the cache line
+					if (*next == current)
+						return from_offset(current);
+
+					if (offset.compare_exchange_weak(current, static_cast<storage_type>(*next), order, std::memory_order_relaxed))
+						return from_offset(current);
+				}
+			}
+		}
+
+		std::atomic<storage_type> offset;
+	};
+}
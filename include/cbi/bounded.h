@@ -1,11 +1,26 @@
 #pragma once
+#include <algorithm>
+#include <cassert>
+#include <compare>
 #include <concepts>
+#include <optional>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
 #include "cbi/details.h"
 
 namespace cbi
 {
+	// What an update does when its result would leave the bounds of the destination.
+	enum class overflow_policy
+	{
+		saturate, // clamp to the nearest bound
+		reject,   // keep the old value and report the failure
+		wrap      // wrap around modulo width() + 1
+	};
+
 	template <typename T>
-	concept signed_bounded = std::signed_integral<typename T::underlying_type> && requires(T t)
+	concept bounded = details::bounded_underlying<typename T::underlying_type> && requires(T t)
 	{
 		T(std::declval<typename T::underlying_type>());
 		{T::upper_bound()} -> std::same_as<typename T::underlying_type>;
@@ -14,14 +29,24 @@ namespace cbi
 		{T::underlying_min()} -> std::same_as<typename T::underlying_type>;
 	};
 
+	template <typename T>
+	concept signed_bounded = bounded<T> && std::signed_integral<typename T::underlying_type>;
+
+	template <typename T>
+	concept unsigned_bounded = bounded<T> && std::unsigned_integral<typename T::underlying_type>;
+
 
-	template <std::signed_integral Underlying,
+	// Bounds are handled as intmax_t, so the upper bound of an uint64_t Bounded is at most
+	// the intmax_t maximum, which is also its default.
+	template <details::bounded_underlying Underlying,
 		Underlying LowerBound = std::numeric_limits<Underlying>::min(),
-		Underlying UpperBound = std::numeric_limits<Underlying>::max()
+		Underlying UpperBound = details::default_upper_bound<Underlying>
 	>
 		struct Bounded
 	{
 		static_assert(LowerBound <= UpperBound);
+		static_assert(std::cmp_less_equal(UpperBound, std::numeric_limits<std::intmax_t>::max()),
+			"Bounds must be representable in intmax_t");
 	private:
 		Underlying value;
 
@@ -51,7 +76,7 @@ namespace cbi
 			return std::nullopt;
 		}
 
-		template <std::signed_integral NewType>
+		template <details::bounded_underlying NewType>
 		[[nodiscard]] constexpr Bounded<NewType, LowerBound, UpperBound>
 		cast_underlying() const noexcept
 		{
@@ -97,20 +122,24 @@ namespace cbi
 		}
 	};
 
-	static_assert(signed_bounded<Bounded<int8_t>>);
-	static_assert(signed_bounded<Bounded<int16_t>>);
-	static_assert(signed_bounded<Bounded<int32_t>>);
-	static_assert(signed_bounded<Bounded<int64_t>>);
+	static_assert(bounded<Bounded<int8_t>>);
+	static_assert(bounded<Bounded<int16_t>>);
+	static_assert(bounded<Bounded<int32_t>>);
+	static_assert(bounded<Bounded<int64_t>>);
 	static_assert(std::is_standard_layout_v<Bounded<int8_t>>);
 	static_assert(std::is_standard_layout_v<Bounded<int16_t>>);
 	static_assert(std::is_standard_layout_v<Bounded<int32_t>>);
 	static_assert(std::is_standard_layout_v<Bounded<int64_t>>);
+	static_assert(unsigned_bounded<Bounded<uint8_t>>);
+	static_assert(unsigned_bounded<Bounded<uint16_t>>);
+	static_assert(unsigned_bounded<Bounded<uint32_t>>);
+	static_assert(unsigned_bounded<Bounded<uint64_t>>);
 
 
 	template <
-		std::signed_integral Underlying,
+		details::bounded_underlying Underlying,
 		Underlying LowerBound = std::numeric_limits<Underlying>::min(),
-		Underlying UpperBound = std::numeric_limits<Underlying>::max()
+		Underlying UpperBound = details::default_upper_bound<Underlying>
 	>
 	[[nodiscard]] constexpr auto make_bounded(Underlying value) noexcept -> std::optional<Bounded<Underlying, LowerBound, UpperBound>>
 	{
@@ -119,13 +148,58 @@ namespace cbi
 		return std::optional{ Bounded<Underlying, LowerBound, UpperBound>{value} };
 	}
 
+	// A compile time constant as a Bounded holding exactly one value.
+	template <std::intmax_t Value>
+	inline constexpr Bounded<details::least_integral_t<Value, Value>, Value, Value> constant{
+		static_cast<details::least_integral_t<Value, Value>>(Value) };
+
 	namespace details
 	{
+		// Bounded over [Low, High] in the narrowest type that holds it
+		template <std::intmax_t Low, std::intmax_t High>
+		using least_bounded_t = Bounded<least_integral_t<Low, High>, static_cast<least_integral_t<Low, High>>(Low),
+			static_cast<least_integral_t<Low, High>>(High)>;
+
+		template <bounded B>
+		[[nodiscard]] constexpr B from_offset(const std::uintmax_t offset) noexcept
+		{
+			using U = typename B::underlying_type;
+			return B{ static_cast<U>(static_cast<std::uintmax_t>(B::lower_bound()) + offset) };
+		}
+
+		// Number of values of B. Only a domain spanning all 2^64 values, e.g. Bounded<int64_t>,
+		// has more than uintmax_t holds and gets 0; uint64_t bounds stop at INTMAX_MAX.
+		template <bounded B>
+		inline constexpr std::uintmax_t domain_size = unsigned_width(B::lower_bound(), B::upper_bound()) + 1;
+
+		// Whether B has at most max values. Compares the width so the wrapped domain_size of a
+		// 2^64 value domain isn't mistaken for a small one.
+		template <bounded B>
+		[[nodiscard]] constexpr bool domain_at_most(const std::uintmax_t max) noexcept
+		{
+			return unsigned_width(B::lower_bound(), B::upper_bound()) < max;
+		}
+
+		// Moves an offset in [0, width] by +-magnitude and resolves leaving that range as the policy says.
+		// Only the reject policy can fail.
+		template <overflow_policy Policy>
+		[[nodiscard]] constexpr std::optional<std::uintmax_t>
+		policy_step(const std::uintmax_t offset, const std::uintmax_t width,
+			const std::uintmax_t magnitude, const bool negative) noexcept
+		{
+			if constexpr (Policy == overflow_policy::wrap)
+				return wrapped_step(offset, width, magnitude, negative);
+			else if constexpr (Policy == overflow_policy::reject)
+				return limited_step(offset, width, magnitude, negative);
+			else
+				return limited_step(offset, width, magnitude, negative).value_or(negative ? 0 : width);
+		}
+
 		template<
 			intmax_t lower_bound,
 			intmax_t upper_bound,
-			signed_bounded Fst,
-			signed_bounded Sec
+			bounded Fst,
+			bounded Sec
 		>
 			consteval auto find_type(Fst, Sec)
 		{
@@ -150,16 +224,36 @@ namespace cbi
 			{
 				return Bounded<NextSec, lower_bound, upper_bound>{0};
 			}
+			else if constexpr (!std::signed_integral<typename Fst::underlying_type> || !std::signed_integral<typename Sec::underlying_type>)
+			{
+				// unsigned operands can't widen into a negative result, pick the type from the interval
+				return least_bounded_t<lower_bound, upper_bound>{0};
+			}
 			else
 			{
 				return std::false_type{};
 			}
 		}
+
+		// Type the operators compute in: the promoted operand and result type when it is signed,
+		// intmax_t when it is unsigned, so mixed signs and unsigned differences don't wrap.
+		template <bounded Res, bounded Fst, bounded Sec>
+		using arithmetic_t = std::conditional_t<
+			std::is_signed_v<std::common_type_t<int, typename Res::underlying_type, typename Fst::underlying_type, typename Sec::underlying_type>>,
+			std::common_type_t<int, typename Res::underlying_type, typename Fst::underlying_type, typename Sec::underlying_type>,
+			std::intmax_t>;
+
+		template <bounded Res, bounded Fst, bounded Sec>
+		[[nodiscard]] constexpr auto arithmetic_operands(const Fst fst, const Sec sec) noexcept
+		{
+			using T = arithmetic_t<Res, Fst, Sec>;
+			return std::pair{ static_cast<T>(fst.get()), static_cast<T>(sec.get()) };
+		}
 	}
 
 	template <
-		signed_bounded Fst,
-		signed_bounded Sec
+		bounded Fst,
+		bounded Sec
 	>
 	constexpr auto operator+(Fst fst, Sec sec)
 	{
@@ -172,12 +266,13 @@ namespace cbi
 		using ResType = decltype(details::find_type<*lower_bound, *upper_bound>(fst, sec));
 		static_assert(!std::same_as<ResType, std::false_type>, "Couldn't find fitting type");
 
-		return ResType{ static_cast<typename ResType::underlying_type>(fst.get() + sec.get()) };
+		const auto [a, b] = details::arithmetic_operands<ResType>(fst, sec);
+		return ResType{ static_cast<typename ResType::underlying_type>(a + b) };
 	}
 
 	template <
-		signed_bounded Fst,
-		signed_bounded Sec
+		bounded Fst,
+		bounded Sec
 	>
 	constexpr auto operator-(Fst fst, Sec sec)
 	{
@@ -193,12 +288,13 @@ namespace cbi
 		using ResType = decltype(details::find_type<lower_bound, upper_bound>(fst, sec));
 		static_assert(!std::same_as<ResType, std::false_type>, "Couldn't find fitting type");
 
-		return ResType{ static_cast<typename ResType::underlying_type>(fst.get() - sec.get()) };
+		const auto [a, b] = details::arithmetic_operands<ResType>(fst, sec);
+		return ResType{ static_cast<typename ResType::underlying_type>(a - b) };
 	}
 
 	template <
-		signed_bounded Fst,
-		signed_bounded Sec
+		bounded Fst,
+		bounded Sec
 	>
 	constexpr auto operator*(Fst fst, Sec sec)
 	{
@@ -214,28 +310,458 @@ namespace cbi
 		using ResType = decltype(details::find_type<lower_bound, upper_bound>(fst, sec));
 		static_assert(!std::same_as<ResType, std::false_type>, "Couldn't find fitting type");
 
-		return ResType{ static_cast<typename ResType::underlying_type>(fst.get() * sec.get()) };
+		const auto [a, b] = details::arithmetic_operands<ResType>(fst, sec);
+		return ResType{ static_cast<typename ResType::underlying_type>(a * b) };
 	}
 
 	template <
-		signed_bounded Fst,
-		signed_bounded Sec
+		bounded Fst,
+		bounded Sec
 	>
 	constexpr auto operator/(Fst fst, Sec sec)
 	{
 		static_assert(Sec::lower_bound() > 0 && Sec::upper_bound() > 0 ||
 			Sec::lower_bound() < 0 && Sec::upper_bound() < 0, "Division by zero is possible");
 
-		constexpr auto b0 = Fst::upper_bound() / Sec::upper_bound();
-		constexpr auto b1 = Fst::upper_bound() / Sec::lower_bound();
-		constexpr auto b2 = Fst::lower_bound() / Sec::upper_bound(); 
-		constexpr auto b3 = Fst::lower_bound() / Sec::lower_bound();
+		constexpr std::intmax_t fst_upper = Fst::upper_bound(), fst_lower = Fst::lower_bound();
+		constexpr std::intmax_t sec_upper = Sec::upper_bound(), sec_lower = Sec::lower_bound();
+		constexpr auto b0 = fst_upper / sec_upper;
+		constexpr auto b1 = fst_upper / sec_lower;
+		constexpr auto b2 = fst_lower / sec_upper;
+		constexpr auto b3 = fst_lower / sec_lower;
 		constexpr auto lower_bound = std::min(std::min(std::min(b0, b1), b2), b3);
 		constexpr auto upper_bound = std::max(std::max(std::max(b0, b1), b2), b3);
 
 		using ResType = decltype(details::find_type<lower_bound, upper_bound>(fst, sec));
 		static_assert(!std::same_as<ResType, std::false_type>, "Couldn't find fitting type");
 
-		return ResType{ static_cast<typename ResType::underlying_type>(fst.get() / sec.get()) };
+		const auto [a, b] = details::arithmetic_operands<ResType>(fst, sec);
+		return ResType{ static_cast<typename ResType::underlying_type>(a / b) };
+	}
+
+	template <bounded B>
+	constexpr auto operator-(B b)
+	{
+		constexpr auto lower_bound = details::limited_sub(0, B::upper_bound());
+		constexpr auto upper_bound = details::limited_sub(0, B::lower_bound());
+		static_assert(lower_bound.has_value() && upper_bound.has_value(), "Possible overflow detected!");
+
+		using ResType = details::least_bounded_t<*lower_bound, *upper_bound>;
+		return ResType{ static_cast<typename ResType::underlying_type>(-static_cast<std::intmax_t>(b.get())) };
+	}
+
+	template <
+		bounded Fst,
+		bounded Sec
+	>
+	constexpr auto operator%(Fst fst, Sec sec)
+	{
+		static_assert(Sec::lower_bound() > 0 && Sec::upper_bound() > 0 ||
+			Sec::lower_bound() < 0 && Sec::upper_bound() < 0, "Division by zero is possible");
+		constexpr auto bounds = details::mod_bounds({ Fst::lower_bound(), Fst::upper_bound() }, { Sec::lower_bound(), Sec::upper_bound() });
+
+		using ResType = decltype(details::find_type<bounds.low, bounds.high>(fst, sec));
+		static_assert(!std::same_as<ResType, std::false_type>, "Couldn't find fitting type");
+		static_assert(std::cmp_not_equal(Fst::lower_bound(), std::numeric_limits<details::arithmetic_t<ResType, Fst, Sec>>::min()) ||
+			std::cmp_greater(Sec::lower_bound(), -1) || std::cmp_less(Sec::upper_bound(), -1), "Possible overflow detected!");
+
+		const auto [a, b] = details::arithmetic_operands<ResType>(fst, sec);
+		return ResType{ static_cast<typename ResType::underlying_type>(a % b) };
+	}
+
+	template <
+		bounded Fst,
+		bounded Sec
+	>
+	constexpr auto operator&(Fst fst, Sec sec)
+	{
+		constexpr auto bounds = details::and_bounds({ Fst::lower_bound(), Fst::upper_bound() }, { Sec::lower_bound(), Sec::upper_bound() });
+
+		using ResType = decltype(details::find_type<bounds.low, bounds.high>(fst, sec));
+		static_assert(!std::same_as<ResType, std::false_type>, "Couldn't find fitting type");
+
+		const auto [a, b] = details::arithmetic_operands<ResType>(fst, sec);
+		return ResType{ static_cast<typename ResType::underlying_type>(a & b) };
+	}
+
+	template <
+		bounded Fst,
+		bounded Sec
+	>
+	constexpr auto operator|(Fst fst, Sec sec)
+	{
+		constexpr auto bounds = details::or_bounds({ Fst::lower_bound(), Fst::upper_bound() }, { Sec::lower_bound(), Sec::upper_bound() });
+
+		using ResType = decltype(details::find_type<bounds.low, bounds.high>(fst, sec));
+		static_assert(!std::same_as<ResType, std::false_type>, "Couldn't find fitting type");
+
+		const auto [a, b] = details::arithmetic_operands<ResType>(fst, sec);
+		return ResType{ static_cast<typename ResType::underlying_type>(a | b) };
+	}
+
+	template <
+		bounded Fst,
+		bounded Sec
+	>
+	constexpr auto operator^(Fst fst, Sec sec)
+	{
+		constexpr auto bounds = details::xor_bounds({ Fst::lower_bound(), Fst::upper_bound() }, { Sec::lower_bound(), Sec::upper_bound() });
+
+		using ResType = decltype(details::find_type<bounds.low, bounds.high>(fst, sec));
+		static_assert(!std::same_as<ResType, std::false_type>, "Couldn't find fitting type");
+
+		const auto [a, b] = details::arithmetic_operands<ResType>(fst, sec);
+		return ResType{ static_cast<typename ResType::underlying_type>(a ^ b) };
+	}
+
+	// The shift count is a Bounded proven to be below the width of intmax_t, the shift itself
+	// is done in intmax_t so it is defined for every count the bounds allow.
+
+	template <
+		bounded Fst,
+		bounded Sec
+	>
+	constexpr auto operator<<(Fst fst, Sec sec)
+	{
+		static_assert(Sec::lower_bound() >= 0 && Sec::upper_bound() < std::numeric_limits<std::uintmax_t>::digits,
+			"Shift count out of range");
+
+		constexpr auto lower_bound = details::limited_shl(Fst::lower_bound(), Fst::lower_bound() < 0 ? Sec::upper_bound() : Sec::lower_bound());
+		constexpr auto upper_bound = details::limited_shl(Fst::upper_bound(), Fst::upper_bound() < 0 ? Sec::lower_bound() : Sec::upper_bound());
+		static_assert(lower_bound.has_value() && upper_bound.has_value(), "Possible overflow detected!");
+
+		// shifting can outgrow the next size up that find_type tries
+		using ResType = details::least_bounded_t<*lower_bound, *upper_bound>;
+		return ResType{ static_cast<typename ResType::underlying_type>(static_cast<std::intmax_t>(fst.get()) << sec.get()) };
+	}
+
+	template <
+		bounded Fst,
+		bounded Sec
+	>
+	constexpr auto operator>>(Fst fst, Sec sec)
+	{
+		static_assert(Sec::lower_bound() >= 0 && Sec::upper_bound() < std::numeric_limits<std::uintmax_t>::digits,
+			"Shift count out of range");
+
+		constexpr std::intmax_t lower_bound = Fst::lower_bound() >> (Fst::lower_bound() < 0 ? Sec::lower_bound() : Sec::upper_bound());
+		constexpr std::intmax_t upper_bound = Fst::upper_bound() >> (Fst::upper_bound() < 0 ? Sec::upper_bound() : Sec::lower_bound());
+
+		using ResType = decltype(details::find_type<lower_bound, upper_bound>(fst, sec));
+		static_assert(!std::same_as<ResType, std::false_type>, "Couldn't find fitting type");
+
+		return ResType{ static_cast<typename ResType::underlying_type>(static_cast<std::intmax_t>(fst.get()) >> sec.get()) };
+	}
+
+	namespace details
+	{
+		// Whether every result in [low, high] lands in the bounds of B.
+		template <bounded B>
+		[[nodiscard]] constexpr bool proven_in_bounds(const std::optional<std::intmax_t> low, const std::optional<std::intmax_t> high) noexcept
+		{
+			return low.has_value() && high.has_value() && std::cmp_less_equal(B::lower_bound(), *low) && std::cmp_less_equal(*high, B::upper_bound());
+		}
+
+		// Stores a result that may lie outside B as the policy says, one unsigned compare decides
+		// whether it fits. Returns whether the exact result was stored, a rejected update leaves
+		// dest unchanged.
+		template <overflow_policy Policy, bounded B>
+		constexpr bool store_with_policy(B& dest, const std::intmax_t result) noexcept
+		{
+			constexpr std::uintmax_t width = unsigned_width(B::lower_bound(), B::upper_bound());
+			const std::uintmax_t offset = offset_from(result, B::lower_bound());
+			if (offset <= width) [[likely]]
+			{
+				dest = from_offset<B>(offset);
+				return true;
+			}
+
+			if constexpr (Policy == overflow_policy::saturate)
+			{
+				dest = B{ std::cmp_less(result, B::lower_bound()) ? B::lower_bound() : B::upper_bound() };
+			}
+			else if constexpr (Policy == overflow_policy::wrap && width != std::numeric_limits<std::uintmax_t>::max())
+			{
+				// offset is result - lower_bound() modulo 2^N, below the bound it is off by 2^N mod (width + 1)
+				constexpr std::uintmax_t modulus = width + 1;
+				constexpr std::uintmax_t excess = (0 - modulus) % modulus;
+				const std::uintmax_t reduced = offset % modulus;
+				if (std::cmp_greater(result, B::upper_bound()))
+					dest = from_offset<B>(reduced);
+				else
+					dest = from_offset<B>(reduced >= excess ? reduced - excess : reduced + (modulus - excess));
+			}
+			return false;
+		}
+
+		// Same for a step by +-magnitude that may not fit intmax_t, taken on the offset instead.
+		template <overflow_policy Policy, bounded B>
+		constexpr bool step_with_policy(B& dest, const std::uintmax_t magnitude, const bool negative) noexcept
+		{
+			constexpr std::uintmax_t width = unsigned_width(B::lower_bound(), B::upper_bound());
+			const std::uintmax_t offset = offset_from(dest.get(), B::lower_bound());
+			if (const auto exact = limited_step(offset, width, magnitude, negative)) [[likely]]
+			{
+				dest = from_offset<B>(*exact);
+				return true;
+			}
+
+			if constexpr (Policy != overflow_policy::reject)
+				dest = from_offset<B>(*policy_step<Policy>(offset, width, magnitude, negative));
+			return false;
+		}
+	}
+
+	// In place updates that resolve a result outside the destination's bounds by a policy.
+	// When the bounds prove the result fits they are a plain store. Returns whether the
+	// exact result was stored.
+	template <overflow_policy Policy, bounded B, bounded Other>
+	constexpr bool add_assign(B& dest, const Other other) noexcept
+	{
+		constexpr auto lower_bound = details::limited_add(B::lower_bound(), Other::lower_bound());
+		constexpr auto upper_bound = details::limited_add(B::upper_bound(), Other::upper_bound());
+
+		if constexpr (details::proven_in_bounds<B>(lower_bound, upper_bound))
+		{
+			dest = B{ static_cast<typename B::underlying_type>(dest.get() + other.get()) };
+			return true;
+		}
+		else if constexpr (lower_bound.has_value() && upper_bound.has_value())
+		{
+			return details::store_with_policy<Policy>(dest, static_cast<std::intmax_t>(dest.get()) + other.get());
+		}
+		else
+		{
+			return details::step_with_policy<Policy>(dest, details::magnitude_of(other.get()), other.get() < 0);
+		}
+	}
+
+	template <overflow_policy Policy, bounded B, bounded Other>
+	constexpr bool sub_assign(B& dest, const Other other) noexcept
+	{
+		constexpr auto lower_bound = details::limited_sub(B::lower_bound(), Other::upper_bound());
+		constexpr auto upper_bound = details::limited_sub(B::upper_bound(), Other::lower_bound());
+
+		if constexpr (details::proven_in_bounds<B>(lower_bound, upper_bound))
+		{
+			dest = B{ static_cast<typename B::underlying_type>(dest.get() - other.get()) };
+			return true;
+		}
+		else if constexpr (lower_bound.has_value() && upper_bound.has_value())
+		{
+			return details::store_with_policy<Policy>(dest, static_cast<std::intmax_t>(dest.get()) - other.get());
+		}
+		else
+		{
+			return details::step_with_policy<Policy>(dest, details::magnitude_of(other.get()), other.get() > 0);
+		}
+	}
+
+	template <overflow_policy Policy, bounded B, bounded Other>
+	constexpr bool mul_assign(B& dest, const Other other) noexcept
+	{
+		constexpr auto b0 = details::limited_mul(B::upper_bound(), Other::upper_bound());
+		constexpr auto b1 = details::limited_mul(B::upper_bound(), Other::lower_bound());
+		constexpr auto b2 = details::limited_mul(B::lower_bound(), Other::upper_bound());
+		constexpr auto b3 = details::limited_mul(B::lower_bound(), Other::lower_bound());
+		static_assert(b0.has_value() && b1.has_value() && b2.has_value() && b3.has_value(), "Possible overflow detected!");
+
+		constexpr auto lower_bound = std::min({ *b0, *b1, *b2, *b3 });
+		constexpr auto upper_bound = std::max({ *b0, *b1, *b2, *b3 });
+		if constexpr (details::proven_in_bounds<B>(lower_bound, upper_bound))
+		{
+			dest = B{ static_cast<typename B::underlying_type>(dest.get() * other.get()) };
+			return true;
+		}
+		else
+		{
+			return details::store_with_policy<Policy>(dest, static_cast<std::intmax_t>(dest.get()) * other.get());
+		}
+	}
+
+	template <overflow_policy Policy, bounded B>
+	constexpr bool increment(B& dest) noexcept
+	{
+		return add_assign<Policy>(dest, constant<1>);
+	}
+
+	template <overflow_policy Policy, bounded B>
+	constexpr bool decrement(B& dest) noexcept
+	{
+		return sub_assign<Policy>(dest, constant<1>);
+	}
+
+	// The operators expect the result to fit: a debug build asserts it, and a release build
+	// saturates instead of storing a value outside the destination's bounds.
+
+	template <bounded B, bounded Other>
+	constexpr B& operator+=(B& dest, const Other other) noexcept
+	{
+		[[maybe_unused]] const bool exact = add_assign<overflow_policy::saturate>(dest, other);
+		assert(exact);
+		return dest;
+	}
+
+	template <bounded B, bounded Other>
+	constexpr B& operator-=(B& dest, const Other other) noexcept
+	{
+		[[maybe_unused]] const bool exact = sub_assign<overflow_policy::saturate>(dest, other);
+		assert(exact);
+		return dest;
+	}
+
+	template <bounded B, bounded Other>
+	constexpr B& operator*=(B& dest, const Other other) noexcept
+	{
+		[[maybe_unused]] const bool exact = mul_assign<overflow_policy::saturate>(dest, other);
+		assert(exact);
+		return dest;
+	}
+
+	template <bounded B>
+	constexpr B& operator++(B& dest) noexcept
+	{
+		[[maybe_unused]] const bool exact = increment<overflow_policy::saturate>(dest);
+		assert(exact);
+		return dest;
+	}
+
+	template <bounded B>
+	constexpr B& operator--(B& dest) noexcept
+	{
+		[[maybe_unused]] const bool exact = decrement<overflow_policy::saturate>(dest);
+		assert(exact);
+		return dest;
+	}
+
+	template <bounded B>
+	constexpr B operator++(B& dest, int) noexcept
+	{
+		const B old = dest;
+		++dest;
+		return old;
+	}
+
+	template <bounded B>
+	constexpr B operator--(B& dest, int) noexcept
+	{
+		const B old = dest;
+		--dest;
+		return old;
+	}
+
+	namespace details
+	{
+		// narrowest type holding both operands, both are compared after converting to it
+		template <bounded Fst, bounded Sec>
+		using compare_type = least_signed_t<
+			std::min<std::intmax_t>(Fst::lower_bound(), Sec::lower_bound()),
+			std::max<std::intmax_t>(Fst::upper_bound(), Sec::upper_bound())>;
+
+		template <bounded Fst, bounded Sec>
+		inline constexpr bool always_less = std::cmp_less(Fst::upper_bound(), Sec::lower_bound());
+
+		template <bounded Fst, bounded Sec>
+		inline constexpr bool always_equal = Fst::lower_bound() == Fst::upper_bound() &&
+			Sec::lower_bound() == Sec::upper_bound() && std::cmp_equal(Fst::lower_bound(), Sec::lower_bound());
+	}
+
+	// Comparisons decided by the bounds alone return std::true_type or std::false_type,
+	// so they fold away even in unoptimized builds and can drive if constexpr.
+
+	template <bounded Fst, bounded Sec>
+	[[nodiscard]] constexpr auto operator==(const Fst fst, const Sec sec) noexcept
+	{
+		if constexpr (details::always_less<Fst, Sec> || details::always_less<Sec, Fst>)
+			return std::false_type{};
+		else if constexpr (details::always_equal<Fst, Sec>)
+			return std::true_type{};
+		else
+		{
+			using T = details::compare_type<Fst, Sec>;
+			return static_cast<T>(fst.get()) == static_cast<T>(sec.get());
+		}
+	}
+
+	template <bounded Fst, bounded Sec>
+	[[nodiscard]] constexpr auto operator!=(const Fst fst, const Sec sec) noexcept
+	{
+		if constexpr (details::always_less<Fst, Sec> || details::always_less<Sec, Fst>)
+			return std::true_type{};
+		else if constexpr (details::always_equal<Fst, Sec>)
+			return std::false_type{};
+		else
+			return !(fst == sec);
+	}
+
+	template <bounded Fst, bounded Sec>
+	[[nodiscard]] constexpr auto operator<(const Fst fst, const Sec sec) noexcept
+	{
+		if constexpr (details::always_less<Fst, Sec>)
+			return std::true_type{};
+		else if constexpr (std::cmp_greater_equal(Fst::lower_bound(), Sec::upper_bound()))
+			return std::false_type{};
+		else
+		{
+			using T = details::compare_type<Fst, Sec>;
+			return static_cast<T>(fst.get()) < static_cast<T>(sec.get());
+		}
+	}
+
+	template <bounded Fst, bounded Sec>
+	[[nodiscard]] constexpr auto operator>(const Fst fst, const Sec sec) noexcept
+	{
+		return sec < fst;
+	}
+
+	template <bounded Fst, bounded Sec>
+	[[nodiscard]] constexpr auto operator<=(const Fst fst, const Sec sec) noexcept
+	{
+		if constexpr (std::cmp_less_equal(Fst::upper_bound(), Sec::lower_bound()))
+			return std::true_type{};
+		else if constexpr (details::always_less<Sec, Fst>)
+			return std::false_type{};
+		else
+			return !(sec < fst);
+	}
+
+	template <bounded Fst, bounded Sec>
+	[[nodiscard]] constexpr auto operator>=(const Fst fst, const Sec sec) noexcept
+	{
+		return sec <= fst;
+	}
+
+	// std::strong_ordering has no type level form, a decided result is still a plain constant.
+	template <bounded Fst, bounded Sec>
+	[[nodiscard]] constexpr std::strong_ordering operator<=>(const Fst fst, const Sec sec) noexcept
+	{
+		if constexpr (details::always_less<Fst, Sec>)
+			return std::strong_ordering::less;
+		else if constexpr (details::always_less<Sec, Fst>)
+			return std::strong_ordering::greater;
+		else if constexpr (details::always_equal<Fst, Sec>)
+			return std::strong_ordering::equal;
+		else
+		{
+			using T = details::compare_type<Fst, Sec>;
+			return static_cast<T>(fst.get()) <=> static_cast<T>(sec.get());
+		}
+	}
+
+	// Against plain integers, which are only known at runtime. The reversed and relational
+	// forms are rewritten from these two by the compiler.
+
+	template <bounded B, std::integral I>
+	[[nodiscard]] constexpr bool operator==(const B b, const I value) noexcept
+	{
+		return std::cmp_equal(b.get(), value);
+	}
+
+	template <bounded B, std::integral I>
+	[[nodiscard]] constexpr std::strong_ordering operator<=>(const B b, const I value) noexcept
+	{
+		if (std::cmp_less(b.get(), value)) return std::strong_ordering::less;
+		if (std::cmp_less(value, b.get())) return std::strong_ordering::greater;
+		return std::strong_ordering::equal;
 	}
 }
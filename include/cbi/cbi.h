@@ -1,2 +1,23 @@
 ﻿#pragma once
-#include "bounded.h"
\ No newline at end of file
+#include "bounded.h"
+#include "sort.h"
+#include "histogram.h"
+#include "group_by.h"
+#include "partition.h"
+#include "atomic.h"
+#include "sharded_counter.h"
+#include "packed_record.h"
+#include "wire_view.h"
+#include "soa_table.h"
+#include "tabulate.h"
+#include "memoize.h"
+#include "visit.h"
+#include "split.h"
+#include "math.h"
+#include "checked.h"
+#include "wide.h"
+#include "fixed.h"
+#include "mod_int.h"
+#include "random.h"
+#include "hash_range.h"
+#include "flat_map.h"
\ No newline at end of file
@@ -0,0 +1,83 @@
+#pragma once
+#include <algorithm>
+#include <cstdint>
+#include <optional>
+#include "cbi/bounded.h"
+
+namespace cbi
+{
+	// Arithmetic for operands too wide for the static overflow proof of the operators.
+	// When the bounds do prove the result fits, these are the operators themselves and
+	// return a plain Bounded. Otherwise the operation runs once in the result type, the
+	// overflow flag decides, and the result is std::nullopt when it didn't fit. The
+	// result bounds are the exact ones clamped to intmax_t.
+
+	template <bounded Fst, bounded Sec>
+	[[nodiscard]] constexpr auto checked_add(const Fst fst, const Sec sec) noexcept
+	{
+		constexpr auto lower_bound = details::limited_add(Fst::lower_bound(), Sec::lower_bound());
+		constexpr auto upper_bound = details::limited_add(Fst::upper_bound(), Sec::upper_bound());
+
+		if constexpr (lower_bound.has_value() && upper_bound.has_value())
+		{
+			return fst + sec;
+		}
+		else
+		{
+			using ResType = details::least_bounded_t<details::saturated_add(Fst::lower_bound(), Sec::lower_bound()),
+				details::saturated_add(Fst::upper_bound(), Sec::upper_bound())>;
+			typename ResType::underlying_type res;
+			if (details::overflowing_add(fst.get(), sec.get(), res))
+				return std::optional<ResType>{};
+			return std::optional{ ResType{ res } };
+		}
+	}
+
+	template <bounded Fst, bounded Sec>
+	[[nodiscard]] constexpr auto checked_sub(const Fst fst, const Sec sec) noexcept
+	{
+		constexpr auto lower_bound = details::limited_sub(Fst::lower_bound(), Sec::upper_bound());
+		constexpr auto upper_bound = details::limited_sub(Fst::upper_bound(), Sec::lower_bound());
+
+		if constexpr (lower_bound.has_value() && upper_bound.has_value())
+		{
+			return fst - sec;
+		}
+		else
+		{
+			using ResType = details::least_bounded_t<details::saturated_sub(Fst::lower_bound(), Sec::upper_bound()),
+				details::saturated_sub(Fst::upper_bound(), Sec::lower_bound())>;
+			typename ResType::underlying_type res;
+			if (details::overflowing_sub(fst.get(), sec.get(), res))
+				return std::optional<ResType>{};
+			return std::optional{ ResType{ res } };
+		}
+	}
+
+	template <bounded Fst, bounded Sec>
+	[[nodiscard]] constexpr auto checked_mul(const Fst fst, const Sec sec) noexcept
+	{
+		constexpr auto b0 = details::limited_mul(Fst::upper_bound(), Sec::upper_bound());
+		constexpr auto b1 = details::limited_mul(Fst::upper_bound(), Sec::lower_bound());
+		constexpr auto b2 = details::limited_mul(Fst::lower_bound(), Sec::upper_bound());
+		constexpr auto b3 = details::limited_mul(Fst::lower_bound(), Sec::lower_bound());
+
+		if constexpr (b0.has_value() && b1.has_value() && b2.has_value() && b3.has_value())
+		{
+			return fst * sec;
+		}
+		else
+		{
+			constexpr std::intmax_t s0 = details::saturated_mul(Fst::upper_bound(), Sec::upper_bound());
+			constexpr std::intmax_t s1 = details::saturated_mul(Fst::upper_bound(), Sec::lower_bound());
+			constexpr std::intmax_t s2 = details::saturated_mul(Fst::lower_bound(), Sec::upper_bound());
+			constexpr std::intmax_t s3 = details::saturated_mul(Fst::lower_bound(), Sec::lower_bound());
+
+			using ResType = details::least_bounded_t<std::min({ s0, s1, s2, s3 }), std::max({ s0, s1, s2, s3 })>;
+			typename ResType::underlying_type res;
+			if (details::overflowing_mul(fst.get(), sec.get(), res))
+				return std::optional<ResType>{};
+			return std::optional{ ResType{ res } };
+		}
+	}
+}
@@ -1,24 +1,66 @@
 #pragma once
+#include <algorithm>
+#include <bit>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <optional>
+#include <type_traits>
+#include <utility>
 
 namespace cbi
 {
 
 	namespace details
 	{
-		template <std::signed_integral T> struct next_size {};
+		inline constexpr std::size_t cache_line_bytes = 64;
+
+		template <typename T>
+		concept bounded_underlying = std::integral<T> && !std::same_as<T, bool>;
+
+		// largest value of T that is still representable as an intmax_t bound
+		template <bounded_underlying T>
+		inline constexpr T default_upper_bound = static_cast<T>(std::min<std::uintmax_t>(
+			std::numeric_limits<T>::max(), std::numeric_limits<std::intmax_t>::max()));
+
+		template <bounded_underlying T> struct next_size {};
 
 		template <> struct next_size<int8_t> { using type = int16_t; static constexpr bool value = true; };
 		template <> struct next_size<int16_t> { using type = int32_t; static constexpr bool value = true; };
 		template <> struct next_size<int32_t> { using type = int64_t; static constexpr bool value = true; };
 		template <> struct next_size<int64_t> { using type = int64_t; static constexpr bool value = false; };
-		template <std::signed_integral T> constexpr auto next_size_t = next_size<T>::type;
-		template <std::signed_integral T> constexpr auto next_size_v = next_size<T>::value;
+		template <> struct next_size<uint8_t> { using type = uint16_t; static constexpr bool value = true; };
+		template <> struct next_size<uint16_t> { using type = uint32_t; static constexpr bool value = true; };
+		template <> struct next_size<uint32_t> { using type = uint64_t; static constexpr bool value = true; };
+		template <> struct next_size<uint64_t> { using type = uint64_t; static constexpr bool value = false; };
+		template <bounded_underlying T> constexpr auto next_size_t = next_size<T>::type;
+		template <bounded_underlying T> constexpr auto next_size_v = next_size<T>::value;
 
-		template <std::signed_integral T>
+		template <std::uintmax_t Max>
+		using least_unsigned_t =
+			std::conditional_t<Max <= std::numeric_limits<std::uint8_t>::max(), std::uint8_t,
+			std::conditional_t<Max <= std::numeric_limits<std::uint16_t>::max(), std::uint16_t,
+			std::conditional_t<Max <= std::numeric_limits<std::uint32_t>::max(), std::uint32_t,
+			std::uint64_t>>>;
+
+		template <bounded_underlying T>
 		constexpr auto fits_in(std::intmax_t low, std::intmax_t high)
 		{
-			return std::numeric_limits<T>::min() <= low && high <= std::numeric_limits<T>::max();
+			return std::cmp_less_equal(std::numeric_limits<T>::min(), low) && std::cmp_less_equal(high, std::numeric_limits<T>::max());
 		}
+
+		template <std::intmax_t Low, std::intmax_t High>
+		using least_signed_t =
+			std::conditional_t<fits_in<std::int8_t>(Low, High), std::int8_t,
+			std::conditional_t<fits_in<std::int16_t>(Low, High), std::int16_t,
+			std::conditional_t<fits_in<std::int32_t>(Low, High), std::int32_t,
+			std::int64_t>>>;
+
+		// Narrowest type holding [Low, High], unsigned only where that is narrower than signed.
+		template <std::intmax_t Low, std::intmax_t High>
+		using least_integral_t = std::conditional_t<(Low >= 0 && sizeof(least_unsigned_t<(High < 0 ? 0 : High)>) < sizeof(least_signed_t<Low, High>)),
+			least_unsigned_t<(High < 0 ? 0 : High)>, least_signed_t<Low, High>>;
 		
 
 		[[nodiscard]] constexpr std::optional<std::intmax_t>
@@ -48,11 +90,11 @@ namespace cbi
 			{
 				return std::nullopt;
 			}
-			if (fst < 0 && sec < 0 && fst < std::numeric_limits<std::intmax_t>::min() / sec)
+			if (fst < 0 && sec < 0 && fst < std::numeric_limits<std::intmax_t>::max() / sec)
 			{
 				return std::nullopt;
 			}
-			if (fst > 0 && sec < 0 && fst > std::numeric_limits<std::intmax_t>::min() / sec)
+			if (fst > 0 && sec < 0 && sec < std::numeric_limits<std::intmax_t>::min() / fst)
 			{
 				return std::nullopt;
 			}
@@ -62,5 +104,201 @@ namespace cbi
 			}
 			return fst * sec;
 		}
+
+		// Results that would leave intmax_t are clamped toward their sign.
+
+		[[nodiscard]] constexpr std::intmax_t saturated_add(const std::intmax_t fst, const std::intmax_t sec)
+		{
+			return limited_add(fst, sec).value_or(fst < 0 ? std::numeric_limits<std::intmax_t>::min() : std::numeric_limits<std::intmax_t>::max());
+		}
+
+		[[nodiscard]] constexpr std::intmax_t saturated_sub(const std::intmax_t fst, const std::intmax_t sec)
+		{
+			return limited_sub(fst, sec).value_or(fst < 0 ? std::numeric_limits<std::intmax_t>::min() : std::numeric_limits<std::intmax_t>::max());
+		}
+
+		[[nodiscard]] constexpr std::intmax_t saturated_mul(const std::intmax_t fst, const std::intmax_t sec)
+		{
+			return limited_mul(fst, sec).value_or((fst < 0) != (sec < 0) ? std::numeric_limits<std::intmax_t>::min() : std::numeric_limits<std::intmax_t>::max());
+		}
+
+		// fst op sec computed in R, returns whether the exact result doesn't fit R. Uses the
+		// overflow flag where the compiler exposes it, an intmax_t range check otherwise.
+
+		template <typename Fst, typename Sec, typename R>
+		[[nodiscard]] constexpr bool overflowing_add(const Fst fst, const Sec sec, R& res) noexcept
+		{
+#if defined(__GNUC__) || defined(__clang__)
+			return __builtin_add_overflow(fst, sec, &res);
+#else
+			const auto exact = limited_add(fst, sec);
+			if (!exact.has_value() || !fits_in<R>(*exact, *exact)) return true;
+			res = static_cast<R>(*exact);
+			return false;
+#endif
+		}
+
+		template <typename Fst, typename Sec, typename R>
+		[[nodiscard]] constexpr bool overflowing_sub(const Fst fst, const Sec sec, R& res) noexcept
+		{
+#if defined(__GNUC__) || defined(__clang__)
+			return __builtin_sub_overflow(fst, sec, &res);
+#else
+			const auto exact = limited_sub(fst, sec);
+			if (!exact.has_value() || !fits_in<R>(*exact, *exact)) return true;
+			res = static_cast<R>(*exact);
+			return false;
+#endif
+		}
+
+		template <typename Fst, typename Sec, typename R>
+		[[nodiscard]] constexpr bool overflowing_mul(const Fst fst, const Sec sec, R& res) noexcept
+		{
+#if defined(__GNUC__) || defined(__clang__)
+			return __builtin_mul_overflow(fst, sec, &res);
+#else
+			const auto exact = limited_mul(fst, sec);
+			if (!exact.has_value() || !fits_in<R>(*exact, *exact)) return true;
+			res = static_cast<R>(*exact);
+			return false;
+#endif
+		}
+
+		// fst * 2^shift, shift must be below the width of intmax_t.
+		[[nodiscard]] constexpr std::optional<std::intmax_t>
+		limited_shl(const std::intmax_t fst, const int shift)
+		{
+			if (fst < (std::numeric_limits<std::intmax_t>::min() >> shift) ||
+				fst > (std::numeric_limits<std::intmax_t>::max() >> shift))
+				return std::nullopt;
+			return fst << shift;
+		}
+
+		// Distance between two bounds; always representable, even for the full intmax_t range.
+		[[nodiscard]] constexpr std::uintmax_t
+		unsigned_width(const std::intmax_t low, const std::intmax_t high) noexcept
+		{
+			return static_cast<std::uintmax_t>(high) - static_cast<std::uintmax_t>(low);
+		}
+
+		// Zero based index of a value inside a domain starting at low.
+		[[nodiscard]] constexpr std::uintmax_t
+		offset_from(const std::intmax_t value, const std::intmax_t low) noexcept
+		{
+			return static_cast<std::uintmax_t>(value) - static_cast<std::uintmax_t>(low);
+		}
+
+		// Moves an offset in [0, width] by +-magnitude, fails when the result leaves that range.
+		[[nodiscard]] constexpr std::optional<std::uintmax_t>
+		limited_step(const std::uintmax_t offset, const std::uintmax_t width,
+			const std::uintmax_t magnitude, const bool negative) noexcept
+		{
+			if (negative)
+			{
+				if (magnitude > offset) return std::nullopt;
+				return offset - magnitude;
+			}
+			if (magnitude > width - offset) return std::nullopt;
+			return offset + magnitude;
+		}
+
+		// Same as limited_step, but wraps around modulo width + 1.
+		[[nodiscard]] constexpr std::uintmax_t
+		wrapped_step(const std::uintmax_t offset, const std::uintmax_t width,
+			const std::uintmax_t magnitude, const bool negative) noexcept
+		{
+			if (width == std::numeric_limits<std::uintmax_t>::max())
+				return negative ? offset - magnitude : offset + magnitude;
+
+			const std::uintmax_t modulus = width + 1;
+			const std::uintmax_t reduced = magnitude % modulus;
+			const std::uintmax_t forward = negative && reduced != 0 ? modulus - reduced : reduced;
+			return forward > width - offset ? offset - (modulus - forward) : offset + forward;
+		}
+
+		inline constexpr std::size_t word_bits = 64;
+
+		// Mask of the lowest bits bits of a 64 bit word.
+		[[nodiscard]] constexpr std::uint64_t low_mask(const std::size_t bits) noexcept
+		{
+			return bits >= word_bits ? std::numeric_limits<std::uint64_t>::max() : (std::uint64_t{ 1 } << bits) - 1;
+		}
+
+		// Splits a signed value into magnitude and sign without overflowing on the minimum.
+		[[nodiscard]] constexpr std::uintmax_t magnitude_of(const std::intmax_t value) noexcept
+		{
+			return value < 0 ? 0 - static_cast<std::uintmax_t>(value) : static_cast<std::uintmax_t>(value);
+		}
+
+		struct interval
+		{
+			std::intmax_t low;
+			std::intmax_t high;
+		};
+
+		// Smallest power of two p with [low, high] inside [-p, p - 1].
+		[[nodiscard]] constexpr std::uintmax_t sign_span(const interval range) noexcept
+		{
+			const std::uintmax_t negative = range.low < 0 ? magnitude_of(range.low) : 0;
+			const std::uintmax_t positive = range.high >= 0 ? static_cast<std::uintmax_t>(range.high) + 1 : 0;
+			return std::max(std::bit_ceil(negative), std::bit_ceil(positive));
+		}
+
+		[[nodiscard]] constexpr std::intmax_t negated_span(const std::uintmax_t span) noexcept
+		{
+			return static_cast<std::intmax_t>(0 - span);
+		}
+
+		// Bounds of a & b for a in fst and b in sec. A nonnegative operand bounds the result
+		// from above and makes it nonnegative, two negative operands stay in their sign span.
+		[[nodiscard]] constexpr interval and_bounds(const interval fst, const interval sec) noexcept
+		{
+			if (fst.low >= 0 && sec.low >= 0)
+				return { 0, std::min(fst.high, sec.high) };
+			if (fst.low >= 0)
+				return { 0, fst.high };
+			if (sec.low >= 0)
+				return { 0, sec.high };
+
+			const std::uintmax_t span = std::max(magnitude_of(fst.low), magnitude_of(sec.low));
+			const std::intmax_t high = fst.high < 0 && sec.high < 0 ? std::min(fst.high, sec.high) : std::max(fst.high, sec.high);
+			return { negated_span(std::bit_ceil(span)), high };
+		}
+
+		// a | b == ~(~a & ~b), and ~ maps [low, high] to [~high, ~low]
+		[[nodiscard]] constexpr interval or_bounds(const interval fst, const interval sec) noexcept
+		{
+			const interval res = and_bounds({ ~fst.high, ~fst.low }, { ~sec.high, ~sec.low });
+			return { ~res.high, ~res.low };
+		}
+
+		// The result stays in the common sign span, its sign is known when both signs are.
+		[[nodiscard]] constexpr interval xor_bounds(const interval fst, const interval sec) noexcept
+		{
+			const std::uintmax_t span = std::max(sign_span(fst), sign_span(sec));
+			const auto high = static_cast<std::intmax_t>(span - 1);
+			const bool fst_nonnegative = fst.low >= 0, fst_negative = fst.high < 0;
+			const bool sec_nonnegative = sec.low >= 0, sec_negative = sec.high < 0;
+
+			if ((fst_nonnegative && sec_nonnegative) || (fst_negative && sec_negative))
+				return { 0, high };
+			if ((fst_nonnegative && sec_negative) || (fst_negative && sec_nonnegative))
+				return { negated_span(span), -1 };
+			return { negated_span(span), high };
+		}
+
+		// Bounds of a % b for a divisor range not containing zero. The remainder takes the sign
+		// of the dividend and is smaller than the largest divisor magnitude; dividends smaller
+		// than every divisor are returned unchanged.
+		[[nodiscard]] constexpr interval mod_bounds(const interval fst, const interval sec) noexcept
+		{
+			const std::uintmax_t smallest = std::min(magnitude_of(sec.low), magnitude_of(sec.high));
+			const std::uintmax_t largest = std::max(magnitude_of(sec.low), magnitude_of(sec.high));
+			if (magnitude_of(fst.low) < smallest && magnitude_of(fst.high) < smallest)
+				return fst;
+
+			const auto cap = static_cast<std::intmax_t>(largest - 1);
+			return { fst.low >= 0 ? 0 : std::max(fst.low, -cap), fst.high <= 0 ? 0 : std::min(fst.high, cap) };
+		}
 	}
 }
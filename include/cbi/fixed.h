@@ -0,0 +1,197 @@
+#pragma once
+#include <cmath>
+#include <compare>
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <utility>
+#include "cbi/bounded.h"
+
+namespace cbi
+{
+	namespace details
+	{
+		inline constexpr unsigned max_decimal_scale = 18;
+
+		[[nodiscard]] constexpr std::intmax_t pow10(const unsigned exponent) noexcept
+		{
+			std::intmax_t res = 1;
+			for (unsigned i = 0; i < exponent; ++i)
+				res *= 10;
+			return res;
+		}
+	}
+
+	// Decimal fixed point number, raw() / 10^Scale. The raw value is a Bounded so results
+	// of arithmetic get their bounds and overflow checks from the Bounded operators.
+	template <bounded B, unsigned Scale>
+	class fixed
+	{
+		static_assert(Scale <= details::max_decimal_scale, "Scale too large for intmax_t");
+
+	public:
+		using raw_type = B;
+		static constexpr unsigned scale = Scale;
+		static constexpr std::intmax_t factor = details::pow10(Scale);
+
+		constexpr explicit fixed(const B raw) noexcept : value(raw) {}
+
+		[[nodiscard]] constexpr B raw() const noexcept { return value; }
+
+		[[nodiscard]] static constexpr fixed lowest() noexcept { return fixed{ B{ B::lower_bound() } }; }
+		[[nodiscard]] static constexpr fixed highest() noexcept { return fixed{ B{ B::upper_bound() } }; }
+
+		// Rounds to the nearest representable value, std::nullopt when it is out of bounds or not a number.
+		[[nodiscard]] static std::optional<fixed> from_double(const double number) noexcept
+		{
+			const double scaled = std::round(number * static_cast<double>(factor));
+			if (!(scaled >= -0x1p63 && scaled < 0x1p63))
+				return std::nullopt;
+
+			const auto raw = static_cast<std::intmax_t>(scaled);
+			if (std::cmp_less(raw, B::lower_bound()) || std::cmp_greater(raw, B::upper_bound()))
+				return std::nullopt;
+			return fixed{ B{ static_cast<typename B::underlying_type>(raw) } };
+		}
+
+		// Parses [-]digits[.digits] with at most Scale fractional digits, std::nullopt when the
+		// text is malformed or the value is out of bounds.
+		[[nodiscard]] static constexpr std::optional<fixed> from_string(const std::string_view text) noexcept
+		{
+			const bool negative = !text.empty() && text.front() == '-';
+			const std::string_view digits = negative ? text.substr(1) : text;
+			const std::size_t point = digits.find('.');
+			const std::string_view whole = digits.substr(0, point);
+			const std::string_view fraction = point == std::string_view::npos ? std::string_view{} : digits.substr(point + 1);
+			if (whole.empty() || fraction.size() > Scale || (point != std::string_view::npos && fraction.empty()))
+				return std::nullopt;
+
+			std::optional<std::intmax_t> raw = 0;
+			const auto append = [&raw, negative](const char digit)
+			{
+				if (digit < '0' || digit > '9')
+					return false;
+				raw = details::limited_mul(*raw, 10);
+				if (raw.has_value())
+					raw = details::limited_add(*raw, negative ? '0' - digit : digit - '0');
+				return raw.has_value();
+			};
+
+			for (const char digit : whole)
+				if (!append(digit)) return std::nullopt;
+			for (const char digit : fraction)
+				if (!append(digit)) return std::nullopt;
+			for (std::size_t i = fraction.size(); i < Scale; ++i)
+				if (!append('0')) return std::nullopt;
+
+			if (std::cmp_less(*raw, B::lower_bound()) || std::cmp_greater(*raw, B::upper_bound()))
+				return std::nullopt;
+			return fixed{ B{ static_cast<typename B::underlying_type>(*raw) } };
+		}
+
+		[[nodiscard]] constexpr double to_double() const noexcept
+		{
+			return static_cast<double>(value.get()) / static_cast<double>(factor);
+		}
+
+		// Exactly Scale fractional digits.
+		[[nodiscard]] std::string to_string() const
+		{
+			const std::intmax_t raw = value.get();
+			const std::uintmax_t magnitude = details::magnitude_of(raw);
+			std::string res = raw < 0 ? "-" : "";
+			res += std::to_string(magnitude / factor);
+			if constexpr (Scale > 0)
+			{
+				const std::string fraction = std::to_string(magnitude % factor);
+				res += '.';
+				res.append(Scale - fraction.size(), '0');
+				res += fraction;
+			}
+			return res;
+		}
+
+	private:
+		B value;
+	};
+
+	template <unsigned Scale, bounded B>
+	[[nodiscard]] constexpr fixed<B, Scale> make_fixed(const B raw) noexcept
+	{
+		return fixed<B, Scale>{ raw };
+	}
+
+	// Converts to another scale. Gaining digits multiplies the raw value and is exact,
+	// dropping digits divides it and truncates toward zero.
+	template <unsigned NewScale, bounded B, unsigned Scale>
+	[[nodiscard]] constexpr auto rescale(const fixed<B, Scale> number) noexcept
+	{
+		if constexpr (NewScale == Scale)
+			return number;
+		else if constexpr (NewScale > Scale)
+			return make_fixed<NewScale>(number.raw() * constant<details::pow10(NewScale - Scale)>);
+		else
+			return make_fixed<NewScale>(number.raw() / constant<details::pow10(Scale - NewScale)>);
+	}
+
+	template <bounded Fst, bounded Sec, unsigned Scale>
+	[[nodiscard]] constexpr auto operator+(const fixed<Fst, Scale> fst, const fixed<Sec, Scale> sec)
+	{
+		return make_fixed<Scale>(fst.raw() + sec.raw());
+	}
+
+	template <bounded Fst, bounded Sec, unsigned Scale>
+	[[nodiscard]] constexpr auto operator-(const fixed<Fst, Scale> fst, const fixed<Sec, Scale> sec)
+	{
+		return make_fixed<Scale>(fst.raw() - sec.raw());
+	}
+
+	template <bounded B, unsigned Scale>
+	[[nodiscard]] constexpr auto operator-(const fixed<B, Scale> number)
+	{
+		return make_fixed<Scale>(-number.raw());
+	}
+
+	// The exact product, its scale is the sum of both scales; rescale it to drop digits.
+	template <bounded Fst, unsigned FstScale, bounded Sec, unsigned SecScale>
+	[[nodiscard]] constexpr auto operator*(const fixed<Fst, FstScale> fst, const fixed<Sec, SecScale> sec)
+	{
+		return make_fixed<FstScale + SecScale>(fst.raw() * sec.raw());
+	}
+
+	// Product rounded toward zero to ResultScale digits.
+	template <unsigned ResultScale, bounded Fst, unsigned FstScale, bounded Sec, unsigned SecScale>
+	[[nodiscard]] constexpr auto multiply(const fixed<Fst, FstScale> fst, const fixed<Sec, SecScale> sec)
+	{
+		return rescale<ResultScale>(fst * sec);
+	}
+
+	// Quotient truncated toward zero to ResultScale digits. The dividend is rescaled to
+	// ResultScale plus the divisor's scale first, so that must fit, and the divisor's bounds
+	// must exclude zero. Truncating twice gives the same result as truncating once.
+	template <unsigned ResultScale, bounded Fst, unsigned FstScale, bounded Sec, unsigned SecScale>
+	[[nodiscard]] constexpr auto divide(const fixed<Fst, FstScale> fst, const fixed<Sec, SecScale> sec)
+	{
+		return make_fixed<ResultScale>(rescale<ResultScale + SecScale>(fst).raw() / sec.raw());
+	}
+
+	// Quotient at the scale of the dividend.
+	template <bounded Fst, unsigned FstScale, bounded Sec, unsigned SecScale>
+	[[nodiscard]] constexpr auto operator/(const fixed<Fst, FstScale> fst, const fixed<Sec, SecScale> sec)
+	{
+		return divide<FstScale>(fst, sec);
+	}
+
+	template <bounded Fst, bounded Sec, unsigned Scale>
+	[[nodiscard]] constexpr bool operator==(const fixed<Fst, Scale> fst, const fixed<Sec, Scale> sec) noexcept
+	{
+		return fst.raw() == sec.raw();
+	}
+
+	template <bounded Fst, bounded Sec, unsigned Scale>
+	[[nodiscard]] constexpr std::strong_ordering operator<=>(const fixed<Fst, Scale> fst, const fixed<Sec, Scale> sec) noexcept
+	{
+		return fst.raw() <=> sec.raw();
+	}
+}
@@ -0,0 +1,281 @@
+#pragma once
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <optional>
+#include <utility>
+#include <vector>
+#include "cbi/bounded.h"
+#include "cbi/hash_range.h"
+#include "cbi/wide.h"
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define CBI_GROUP_SSE2 1
+#endif
+
+namespace cbi
+{
+	namespace details
+	{
+		// Slots are probed a group at a time, one control byte per slot: the high bit marks
+		// a free slot, full slots hold 7 bits of the key's hash.
+		inline constexpr std::size_t group_slots = 16;
+		inline constexpr std::uint8_t empty_slot = 0x80;
+		inline constexpr std::uint8_t deleted_slot = 0xFE;
+
+		// Bit i set where control byte i of the group equals tag.
+		[[nodiscard]] inline std::uint32_t match_tag(const std::uint8_t* group, const std::uint8_t tag) noexcept
+		{
+#if defined(CBI_GROUP_SSE2)
+			const __m128i ctrl = _mm_loadu_si128(reinterpret_cast<const __m128i*>(group));
+			return static_cast<std::uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(ctrl, _mm_set1_epi8(static_cast<char>(tag)))));
+#else
+			std::uint32_t mask = 0;
+			for (std::size_t i = 0; i < group_slots; ++i)
+				mask |= static_cast<std::uint32_t>(group[i] == tag) << i;
+			return mask;
+#endif
+		}
+
+		// Bit i set where slot i of the group is empty or deleted.
+		[[nodiscard]] inline std::uint32_t match_free(const std::uint8_t* group) noexcept
+		{
+#if defined(CBI_GROUP_SSE2)
+			return static_cast<std::uint32_t>(_mm_movemask_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(group))));
+#else
+			std::uint32_t mask = 0;
+			for (std::size_t i = 0; i < group_slots; ++i)
+				mask |= static_cast<std::uint32_t>(group[i] >> 7) << i;
+			return mask;
+#endif
+		}
+
+		// Folded multiply, spreads hashes like the identity std::hash of integers over all bits.
+		[[nodiscard]] constexpr std::uint64_t mix_hash(const std::uint64_t hash) noexcept
+		{
+			constexpr std::uint64_t factor = 0x9E3779B97F4A7C15;
+			return mul_high(hash, factor) ^ (hash * factor);
+		}
+
+		// Only declared here, the tests define it to reach the private probe statistics of a flat_map.
+		struct flat_map_probe;
+	}
+
+	// Open addressing hash map of at most MaxSlots slots, sized once on construction.
+	// Entries are stored densely in insertion order, erasing moves the last entry into the
+	// hole. Each slot holds a control byte and the index of its entry, in the narrowest
+	// type the capacity allows, e.g. 16 bits up to 65536 slots. The home group comes from
+	// reduce_to, probing then moves group by group, and slot and entry indices are Bounded
+	// so the arrays are indexed without checks.
+	template <typename K, typename V, std::size_t MaxSlots, typename Hash = std::hash<K>>
+	class flat_map
+	{
+		static_assert(MaxSlots > 0);
+		static constexpr std::size_t max_groups = (MaxSlots + details::group_slots - 1) / details::group_slots;
+		static constexpr std::size_t max_slots = max_groups * details::group_slots;
+		static constexpr std::size_t max_entries = max_slots - max_slots / 8;
+
+		using group_count = Bounded<details::least_unsigned_t<max_groups>, 1, max_groups>;
+		using group_index = Bounded<details::least_unsigned_t<max_groups - 1>, 0, max_groups - 1>;
+		using lane_index = Bounded<std::uint8_t, 0, details::group_slots - 1>;
+
+	public:
+		using key_type = K;
+		using mapped_type = V;
+		using value_type = std::pair<K, V>;
+		using slot_count_type = Bounded<details::least_unsigned_t<max_slots>, 1, max_slots>;
+		using entry_index = Bounded<details::least_unsigned_t<max_entries - 1>, 0, max_entries - 1>;
+
+		flat_map() : flat_map(slot_count_type{ max_slots }) {}
+
+		// At least slots slots, rounded up to whole groups; holds 7/8 of them.
+		explicit flat_map(const slot_count_type slots, Hash hash = Hash{})
+			: hasher(std::move(hash)),
+			groups(static_cast<typename group_count::underlying_type>((slots.get() + details::group_slots - 1) / details::group_slots)),
+			ctrl(groups.get() * details::group_slots, details::empty_slot),
+			slot_entries(groups.get() * details::group_slots, entry_index{ 0 })
+		{
+			items.reserve(capacity());
+		}
+
+		[[nodiscard]] std::size_t size() const noexcept { return items.size(); }
+		[[nodiscard]] bool empty() const noexcept { return items.empty(); }
+		[[nodiscard]] std::size_t slot_count() const noexcept { return ctrl.size(); }
+		[[nodiscard]] std::size_t capacity() const noexcept { return slot_count() - slot_count() / 8; }
+
+		[[nodiscard]] auto begin() const noexcept { return items.cbegin(); }
+		[[nodiscard]] auto end() const noexcept { return items.cend(); }
+
+		[[nodiscard]] V* find(const K& key) noexcept
+		{
+			const auto slot = find_slot(key, hash_of(key));
+			return slot ? &items[slot_entries[*slot].get()].second : nullptr;
+		}
+
+		[[nodiscard]] const V* find(const K& key) const noexcept
+		{
+			const auto slot = find_slot(key, hash_of(key));
+			return slot ? &items[slot_entries[*slot].get()].second : nullptr;
+		}
+
+		[[nodiscard]] bool contains(const K& key) const noexcept
+		{
+			return find_slot(key, hash_of(key)).has_value();
+		}
+
+		// Inserts the key or assigns to its value. Returns false when the key is new and the map is full.
+		bool insert_or_assign(const K& key, V value)
+		{
+			const std::uint64_t hash = hash_of(key);
+			if (const auto slot = find_slot(key, hash))
+			{
+				items[slot_entries[*slot].get()].second = std::move(value);
+				return true;
+			}
+			if (size() == capacity())
+				return false;
+			if (size() + tombstones >= capacity())
+				drop_deleted();
+
+			const std::size_t slot = free_slot(hash);
+			items.emplace_back(key, std::move(value));
+			if (ctrl[slot] == details::deleted_slot)
+				--tombstones;
+			ctrl[slot] = tag_of(hash);
+			slot_entries[slot] = entry_index{ static_cast<typename entry_index::underlying_type>(items.size() - 1) };
+			return true;
+		}
+
+		bool erase(const K& key)
+		{
+			const auto slot = find_slot(key, hash_of(key));
+			if (!slot)
+				return false;
+
+			// a probe that reaches a group with an empty slot stops there anyway,
+			// so only groups without one need a tombstone to keep later keys reachable
+			const std::size_t group = *slot / details::group_slots * details::group_slots;
+			const bool tombstone = details::match_tag(&ctrl[group], details::empty_slot) == 0;
+			ctrl[*slot] = tombstone ? details::deleted_slot : details::empty_slot;
+
+			const entry_index index = slot_entries[*slot];
+			if (index.get() + std::size_t{ 1 } != items.size())
+			{
+				slot_entries[*find_slot(items.back().first, hash_of(items.back().first))] = index;
+				items[index.get()] = std::move(items.back());
+			}
+			items.pop_back();
+
+			// tombstones turn groups into ones a probe can't stop at, a few are reused by
+			// inserts but past a sixteenth of the slots all of them are dropped at once
+			if (tombstone && ++tombstones > slot_count() / 16)
+				drop_deleted();
+			return true;
+		}
+
+		void clear() noexcept
+		{
+			std::fill(ctrl.begin(), ctrl.end(), details::empty_slot);
+			items.clear();
+			tombstones = 0;
+		}
+
+	private:
+		friend struct details::flat_map_probe;
+
+		// Groups without an empty slot, every lookup of a missing key probes past them.
+		[[nodiscard]] std::size_t full_groups() const noexcept
+		{
+			std::size_t res = 0;
+			for (std::size_t group = 0; group < slot_count(); group += details::group_slots)
+				res += details::match_tag(&ctrl[group], details::empty_slot) == 0;
+			return res;
+		}
+
+		[[nodiscard]] std::uint64_t hash_of(const K& key) const noexcept
+		{
+			return details::mix_hash(static_cast<std::uint64_t>(hasher(key)));
+		}
+
+		// The home group takes the high bits of the hash, the tag the low ones.
+		[[nodiscard]] group_index home_group(const std::uint64_t hash) const noexcept
+		{
+			return reduce_to(hash, groups);
+		}
+
+		[[nodiscard]] static std::uint8_t tag_of(const std::uint64_t hash) noexcept
+		{
+			return static_cast<std::uint8_t>(hash & 0x7F);
+		}
+
+		[[nodiscard]] group_index next_group(const group_index group) const noexcept
+		{
+			const auto next = group.get() + std::size_t{ 1 };
+			return group_index{ static_cast<typename group_index::underlying_type>(next == groups.get() ? 0 : next) };
+		}
+
+		// Slot of the lowest set bit of a group match, bounded by the largest slot count.
+		[[nodiscard]] static std::size_t slot_of(const group_index group, const std::uint32_t match) noexcept
+		{
+			const lane_index lane{ static_cast<std::uint8_t>(std::countr_zero(match)) };
+			return static_cast<std::size_t>((group * constant<details::group_slots> + lane).get());
+		}
+
+		// First empty or deleted slot of the probe sequence. One exists as size() is below capacity().
+		[[nodiscard]] std::size_t free_slot(const std::uint64_t hash) const noexcept
+		{
+			group_index group = home_group(hash);
+			std::uint32_t free = details::match_free(&ctrl[group.get() * details::group_slots]);
+			while (free == 0)
+			{
+				group = next_group(group);
+				free = details::match_free(&ctrl[group.get() * details::group_slots]);
+			}
+			return slot_of(group, free);
+		}
+
+		// Rebuilds the slots from the dense entries without any tombstones, the entries stay where they are.
+		void drop_deleted() noexcept
+		{
+			std::fill(ctrl.begin(), ctrl.end(), details::empty_slot);
+			for (std::size_t i = 0; i < items.size(); ++i)
+			{
+				const std::uint64_t hash = hash_of(items[i].first);
+				const std::size_t slot = free_slot(hash);
+				ctrl[slot] = tag_of(hash);
+				slot_entries[slot] = entry_index{ static_cast<typename entry_index::underlying_type>(i) };
+			}
+			tombstones = 0;
+		}
+
+		[[nodiscard]] std::optional<std::size_t> find_slot(const K& key, const std::uint64_t hash) const noexcept
+		{
+			const std::uint8_t tag = tag_of(hash);
+			group_index group = home_group(hash);
+			for (std::size_t probe = 0; probe < groups.get(); ++probe)
+			{
+				const std::uint8_t* group_ctrl = &ctrl[group.get() * details::group_slots];
+				for (std::uint32_t match = details::match_tag(group_ctrl, tag); match != 0; match &= match - 1)
+				{
+					const std::size_t slot = slot_of(group, match);
+					if (items[slot_entries[slot].get()].first == key)
+						return slot;
+				}
+				if (details::match_tag(group_ctrl, details::empty_slot) != 0)
+					return std::nullopt;
+				group = next_group(group);
+			}
+			return std::nullopt;
+		}
+
+		Hash hasher;
+		group_count groups;
+		std::vector<std::uint8_t> ctrl;
+		std::vector<entry_index> slot_entries;
+		std::vector<value_type> items;
+		std::size_t tombstones = 0;
+	};
+}
@@ -0,0 +1,191 @@
+#pragma once
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <optional>
+#include <span>
+#include <thread>
+#include <tuple>
+#include <utility>
+#include <vector>
+#include "cbi/bounded.h"
+
+namespace cbi
+{
+	namespace details
+	{
+		inline constexpr std::uintmax_t group_by_max_width = (std::uintmax_t{ 1 } << 24) - 1;
+		inline constexpr std::size_t group_by_min_rows_per_thread = std::size_t{ 1 } << 16;
+
+		// bounds of a sum of at most MaxRows values of Payload, an empty group sums to 0
+		template <bounded Payload, std::size_t MaxRows>
+		struct sum_bounds
+		{
+			static_assert(MaxRows <= static_cast<std::uintmax_t>(std::numeric_limits<std::intmax_t>::max()));
+			static constexpr auto low = limited_mul(Payload::lower_bound(), static_cast<std::intmax_t>(MaxRows));
+			static constexpr auto high = limited_mul(Payload::upper_bound(), static_cast<std::intmax_t>(MaxRows));
+			static_assert(low.has_value() && high.has_value(), "Possible overflow detected!");
+
+			static constexpr std::intmax_t lower_bound = std::min<std::intmax_t>(low.value_or(0), 0);
+			static constexpr std::intmax_t upper_bound = std::max<std::intmax_t>(high.value_or(0), 0);
+			using type = Bounded<least_signed_t<lower_bound, upper_bound>, lower_bound, upper_bound>;
+		};
+
+		template <bounded Payload, std::size_t MaxRows>
+		struct payload_aggregates
+		{
+			using sum_type = typename sum_bounds<Payload, MaxRows>::type;
+			using sum_raw = typename sum_type::underlying_type;
+			using raw = typename Payload::underlying_type;
+
+			std::vector<sum_raw> sum;
+			std::vector<raw> min;
+			std::vector<raw> max;
+
+			explicit payload_aggregates(const std::size_t groups)
+				: sum(groups, 0), min(groups, Payload::upper_bound()), max(groups, Payload::lower_bound())
+			{
+			}
+
+			void add(const std::size_t group, const Payload payload) noexcept
+			{
+				sum[group] += payload.get();
+				min[group] = std::min(min[group], payload.get());
+				max[group] = std::max(max[group], payload.get());
+			}
+
+			void merge(const payload_aggregates& other) noexcept
+			{
+				for (std::size_t group = 0; group < sum.size(); ++group)
+				{
+					sum[group] += other.sum[group];
+					min[group] = std::min(min[group], other.min[group]);
+					max[group] = std::max(max[group], other.max[group]);
+				}
+			}
+		};
+	}
+
+	// Dense aggregation table with one slot per value of Key.
+	// Sums are typed from the payload bounds and MaxRows, so no group can overflow
+	// as long as at most MaxRows rows are added in total.
+	template <bounded Key, std::size_t MaxRows, bounded... Payloads>
+	class group_by_table
+	{
+		static_assert(details::unsigned_width(Key::lower_bound(), Key::upper_bound()) <= details::group_by_max_width,
+			"Key domain too wide for a dense group by");
+
+	public:
+		using key_type = Key;
+		using count_type = Bounded<details::least_signed_t<0, MaxRows>, 0, MaxRows>;
+		template <std::size_t I> using payload_type = std::tuple_element_t<I, std::tuple<Payloads...>>;
+		template <std::size_t I> using sum_type = typename details::sum_bounds<payload_type<I>, MaxRows>::type;
+
+		group_by_table()
+			: counts(size(), 0), columns{ details::payload_aggregates<Payloads, MaxRows>(size())... }
+		{
+		}
+
+		[[nodiscard]] static constexpr std::size_t size() noexcept
+		{
+			return details::unsigned_width(Key::lower_bound(), Key::upper_bound()) + 1;
+		}
+
+		void add(const Key key, const Payloads... payloads) noexcept
+		{
+			const std::size_t group = details::offset_from(key.get(), Key::lower_bound());
+			++counts[group];
+			std::apply([&](auto&... column) { (column.add(group, payloads), ...); }, columns);
+		}
+
+		void merge(const group_by_table& other) noexcept
+		{
+			for (std::size_t group = 0; group < size(); ++group)
+				counts[group] += other.counts[group];
+			merge_columns(other, std::index_sequence_for<Payloads...>{});
+		}
+
+		[[nodiscard]] count_type count(const Key key) const noexcept
+		{
+			return count_type{ counts[details::offset_from(key.get(), Key::lower_bound())] };
+		}
+
+		template <std::size_t I>
+		[[nodiscard]] sum_type<I> sum(const Key key) const noexcept
+		{
+			return sum_type<I>{ std::get<I>(columns).sum[details::offset_from(key.get(), Key::lower_bound())] };
+		}
+
+		template <std::size_t I>
+		[[nodiscard]] std::optional<payload_type<I>> min(const Key key) const noexcept
+		{
+			const std::size_t group = details::offset_from(key.get(), Key::lower_bound());
+			if (counts[group] == 0) return std::nullopt;
+			return std::optional{ payload_type<I>{ std::get<I>(columns).min[group] } };
+		}
+
+		template <std::size_t I>
+		[[nodiscard]] std::optional<payload_type<I>> max(const Key key) const noexcept
+		{
+			const std::size_t group = details::offset_from(key.get(), Key::lower_bound());
+			if (counts[group] == 0) return std::nullopt;
+			return std::optional{ payload_type<I>{ std::get<I>(columns).max[group] } };
+		}
+
+	private:
+		template <std::size_t... I>
+		void merge_columns(const group_by_table& other, std::index_sequence<I...>) noexcept
+		{
+			(std::get<I>(columns).merge(std::get<I>(other.columns)), ...);
+		}
+
+		std::vector<typename count_type::underlying_type> counts;
+		std::tuple<details::payload_aggregates<Payloads, MaxRows>...> columns;
+	};
+
+	// Aggregates count, sum, min and max of every payload column per key.
+	// Expects at most MaxRows rows and payload columns as long as the key column.
+	template <std::size_t MaxRows, bounded Key, bounded... Payloads>
+	[[nodiscard]] auto group_by(std::span<const Key> keys, std::span<const Payloads>... payloads)
+	{
+		assert(keys.size() <= MaxRows);
+		assert(((payloads.size() == keys.size()) && ...));
+
+		group_by_table<Key, MaxRows, Payloads...> res;
+		for (std::size_t row = 0; row < keys.size(); ++row)
+			res.add(keys[row], payloads[row]...);
+		return res;
+	}
+
+	// Same as group_by, but every thread aggregates a slice of the rows into
+	// a private table and the partial tables are merged at the end.
+	template <std::size_t MaxRows, bounded Key, bounded... Payloads>
+	[[nodiscard]] auto parallel_group_by(std::size_t threads, std::span<const Key> keys, std::span<const Payloads>... payloads)
+	{
+		threads = std::clamp<std::size_t>(keys.size() / details::group_by_min_rows_per_thread, 1, std::max<std::size_t>(threads, 1));
+		if (threads == 1)
+			return group_by<MaxRows>(keys, payloads...);
+
+		std::vector<group_by_table<Key, MaxRows, Payloads...>> partials(threads);
+		std::vector<std::jthread> workers;
+		workers.reserve(threads);
+
+		const std::size_t chunk = (keys.size() + threads - 1) / threads;
+		for (std::size_t t = 0; t < threads; ++t)
+		{
+			const std::size_t first = std::min(t * chunk, keys.size());
+			const std::size_t count = std::min(chunk, keys.size() - first);
+			workers.emplace_back([&partials, t, first, count, keys, payloads...]
+			{
+				partials[t] = group_by<MaxRows>(keys.subspan(first, count), payloads.subspan(first, count)...);
+			});
+		}
+		workers.clear();
+
+		for (std::size_t t = 1; t < threads; ++t)
+			partials[0].merge(partials[t]);
+		return std::move(partials[0]);
+	}
+}
@@ -0,0 +1,34 @@
+#pragma once
+#include <cstdint>
+#include <limits>
+#include "cbi/bounded.h"
+#include "cbi/wide.h"
+
+namespace cbi
+{
+	// Maps a hash onto [B::lower_bound(), B::upper_bound()] by the high half of hash * range,
+	// Lemire's multiply-shift replacement for hash % range. Each value gets an equal share of
+	// the hash space up to one, and the result is a valid B without another check. The high
+	// bits of the hash decide, so it should be well mixed there.
+	template <bounded B>
+	[[nodiscard]] constexpr B reduce_to(const std::uint64_t hash) noexcept
+	{
+		constexpr std::uintmax_t width = details::unsigned_width(B::lower_bound(), B::upper_bound());
+
+		std::uint64_t offset = hash;
+		if constexpr (width != std::numeric_limits<std::uintmax_t>::max())
+			offset = details::mul_high(hash, width + 1);
+		return details::from_offset<B>(offset);
+	}
+
+	// Index into a table of n slots, n only known at runtime but bounded by N.
+	// The result is bounded by the largest n, so it fits tables of N::upper_bound() slots.
+	template <bounded N>
+	[[nodiscard]] constexpr auto reduce_to(const std::uint64_t hash, const N n) noexcept
+	{
+		static_assert(N::lower_bound() >= 1, "Empty range is possible");
+
+		using ResType = Bounded<details::least_unsigned_t<N::upper_bound() - 1>, 0, N::upper_bound() - 1>;
+		return ResType{ static_cast<typename ResType::underlying_type>(details::mul_high(hash, static_cast<std::uint64_t>(n.get()))) };
+	}
+}
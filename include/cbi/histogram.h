@@ -0,0 +1,131 @@
+#pragma once
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <thread>
+#include <vector>
+#include "cbi/bounded.h"
+
+namespace cbi
+{
+	namespace details
+	{
+		inline constexpr std::uintmax_t histogram_max_width = (std::uintmax_t{ 1 } << 24) - 1;
+		inline constexpr std::size_t histogram_min_rows_per_thread = std::size_t{ 1 } << 16;
+
+		// number of separate sub-histograms; repeated values land in different
+		// counters so consecutive increments don't wait on each other's stores
+		template <bounded B>
+		consteval std::size_t histogram_lanes()
+		{
+			return unsigned_width(B::lower_bound(), B::upper_bound()) < 1024 ? 4 : 1;
+		}
+
+		template <std::size_t Extent>
+		using histogram_counter_t = std::conditional_t<Extent == std::dynamic_extent,
+			std::size_t, least_unsigned_t<Extent>>;
+
+		template <bounded B, typename Counter>
+		void accumulate_histogram(std::span<const B> values, std::span<Counter> out)
+		{
+			constexpr std::size_t buckets = unsigned_width(B::lower_bound(), B::upper_bound()) + 1;
+			constexpr std::size_t lanes = histogram_lanes<B>();
+
+			if constexpr (lanes == 1)
+			{
+				for (const B value : values)
+					++out[offset_from(value.get(), B::lower_bound())];
+			}
+			else
+			{
+				std::vector<Counter> sub(lanes * buckets);
+
+				std::size_t i = 0;
+				for (; i + lanes <= values.size(); i += lanes)
+				{
+					for (std::size_t lane = 0; lane < lanes; ++lane)
+						++sub[lane * buckets + offset_from(values[i + lane].get(), B::lower_bound())];
+				}
+				for (; i < values.size(); ++i)
+					++sub[offset_from(values[i].get(), B::lower_bound())];
+
+				for (std::size_t bucket = 0; bucket < buckets; ++bucket)
+				{
+					Counter sum = 0;
+					for (std::size_t lane = 0; lane < lanes; ++lane)
+						sum += sub[lane * buckets + bucket];
+					out[bucket] += sum;
+				}
+			}
+		}
+	}
+
+	// Dense counts for every value of B, indexed by the value itself.
+	template <bounded B, std::unsigned_integral Counter>
+	struct histogram_counts
+	{
+		using value_type = B;
+		using counter_type = Counter;
+
+		std::vector<Counter> counts = std::vector<Counter>(size());
+
+		[[nodiscard]] Counter operator[](const B value) const noexcept
+		{
+			return counts[details::offset_from(value.get(), B::lower_bound())];
+		}
+
+		[[nodiscard]] static constexpr std::size_t size() noexcept
+		{
+			return details::unsigned_width(B::lower_bound(), B::upper_bound()) + 1;
+		}
+	};
+
+	// The counter type is the narrowest one that can hold Extent, or std::size_t for dynamic spans,
+	// since no bucket can ever count more values than the span holds.
+	template <bounded B, std::size_t Extent>
+	[[nodiscard]] auto histogram(std::span<const B, Extent> values)
+	{
+		static_assert(details::unsigned_width(B::lower_bound(), B::upper_bound()) <= details::histogram_max_width,
+			"Domain too wide for a dense histogram");
+
+		histogram_counts<B, details::histogram_counter_t<Extent>> res;
+		details::accumulate_histogram(std::span<const B>{ values }, std::span{ res.counts });
+		return res;
+	}
+
+	// Splits the input over up to `threads` threads, each filling a private histogram
+	// that is summed into the result once all of them are done.
+	template <bounded B, std::size_t Extent>
+	[[nodiscard]] auto histogram(std::span<const B, Extent> values, std::size_t threads)
+	{
+		threads = std::clamp<std::size_t>(values.size() / details::histogram_min_rows_per_thread, 1, std::max<std::size_t>(threads, 1));
+		if (threads == 1)
+			return histogram(values);
+
+		using counter_type = details::histogram_counter_t<Extent>;
+		std::vector<histogram_counts<B, counter_type>> partials(threads);
+		std::vector<std::jthread> workers;
+		workers.reserve(threads);
+
+		const std::size_t chunk = (values.size() + threads - 1) / threads;
+		for (std::size_t t = 0; t < threads; ++t)
+		{
+			const std::size_t first = std::min(t * chunk, values.size());
+			const std::size_t count = std::min(chunk, values.size() - first);
+			workers.emplace_back([&partials, t, part = std::span<const B>{ values }.subspan(first, count)]
+			{
+				details::accumulate_histogram(part, std::span{ partials[t].counts });
+			});
+		}
+		workers.clear();
+
+		histogram_counts<B, counter_type> res = std::move(partials[0]);
+		for (std::size_t t = 1; t < threads; ++t)
+		{
+			for (std::size_t bucket = 0; bucket < res.size(); ++bucket)
+				res.counts[bucket] += partials[t].counts[bucket];
+		}
+		return res;
+	}
+}
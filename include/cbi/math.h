@@ -0,0 +1,151 @@
+#pragma once
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <utility>
+#include "cbi/bounded.h"
+
+namespace cbi
+{
+	// The results are Bounded over exactly the values the operation can produce, in the
+	// narrowest type holding them. Values are selected with plain ternaries on a common
+	// type so they lower to cmov or min/max instructions and the span forms vectorize.
+
+	template <bounded Fst, bounded Sec>
+	[[nodiscard]] constexpr auto min(const Fst fst, const Sec sec) noexcept
+	{
+		using ResType = details::least_bounded_t<
+			std::min<std::intmax_t>(Fst::lower_bound(), Sec::lower_bound()),
+			std::min<std::intmax_t>(Fst::upper_bound(), Sec::upper_bound())>;
+		using U = typename ResType::underlying_type;
+
+		if constexpr (std::cmp_less_equal(Fst::upper_bound(), Sec::lower_bound()))
+			return ResType{ static_cast<U>(fst.get()) };
+		else if constexpr (std::cmp_less_equal(Sec::upper_bound(), Fst::lower_bound()))
+			return ResType{ static_cast<U>(sec.get()) };
+		else
+		{
+			using T = details::compare_type<Fst, Sec>;
+			const auto a = static_cast<T>(fst.get());
+			const auto b = static_cast<T>(sec.get());
+			return ResType{ static_cast<U>(b < a ? b : a) };
+		}
+	}
+
+	template <bounded Fst, bounded Sec>
+	[[nodiscard]] constexpr auto max(const Fst fst, const Sec sec) noexcept
+	{
+		using ResType = details::least_bounded_t<
+			std::max<std::intmax_t>(Fst::lower_bound(), Sec::lower_bound()),
+			std::max<std::intmax_t>(Fst::upper_bound(), Sec::upper_bound())>;
+		using U = typename ResType::underlying_type;
+
+		if constexpr (std::cmp_less_equal(Sec::upper_bound(), Fst::lower_bound()))
+			return ResType{ static_cast<U>(fst.get()) };
+		else if constexpr (std::cmp_less_equal(Fst::upper_bound(), Sec::lower_bound()))
+			return ResType{ static_cast<U>(sec.get()) };
+		else
+		{
+			using T = details::compare_type<Fst, Sec>;
+			const auto a = static_cast<T>(fst.get());
+			const auto b = static_cast<T>(sec.get());
+			return ResType{ static_cast<U>(a < b ? b : a) };
+		}
+	}
+
+	// Forces b into [Lo, Hi], narrowed further to the bounds of B where they are tighter.
+	// Unlike shrink_bounds this never fails, out of range values take the nearest bound.
+	template <std::intmax_t Lo, std::intmax_t Hi, bounded B>
+	[[nodiscard]] constexpr auto clamp(const B b) noexcept
+	{
+		static_assert(Lo <= Hi, "Empty clamp range");
+
+		using ResType = details::least_bounded_t<
+			std::clamp<std::intmax_t>(B::lower_bound(), Lo, Hi),
+			std::clamp<std::intmax_t>(B::upper_bound(), Lo, Hi)>;
+		using U = typename ResType::underlying_type;
+
+		// a single possible result, which includes [Lo, Hi] lying entirely outside of B
+		if constexpr (ResType::lower_bound() == ResType::upper_bound())
+		{
+			return ResType{ ResType::lower_bound() };
+		}
+		else
+		{
+			// compared in a type holding both ranges, so the result bounds don't wrap
+			using T = details::least_integral_t<
+				std::min<std::intmax_t>(B::lower_bound(), ResType::lower_bound()),
+				std::max<std::intmax_t>(B::upper_bound(), ResType::upper_bound())>;
+
+			T value = static_cast<T>(b.get());
+			if constexpr (std::cmp_greater(Lo, B::lower_bound()))
+				value = value < static_cast<T>(ResType::lower_bound()) ? static_cast<T>(ResType::lower_bound()) : value;
+			if constexpr (std::cmp_less(Hi, B::upper_bound()))
+				value = static_cast<T>(ResType::upper_bound()) < value ? static_cast<T>(ResType::upper_bound()) : value;
+			return ResType{ static_cast<U>(value) };
+		}
+	}
+
+	template <bounded B>
+	[[nodiscard]] constexpr auto abs(const B b) noexcept
+	{
+		if constexpr (B::lower_bound() >= 0)
+			return b;
+		else if constexpr (B::upper_bound() <= 0)
+			return -b;
+		else
+		{
+			constexpr auto negated = details::limited_sub(0, B::lower_bound());
+			static_assert(negated.has_value(), "Possible overflow detected!");
+
+			constexpr std::intmax_t magnitude = std::max<std::intmax_t>(*negated, B::upper_bound());
+			using ResType = details::least_bounded_t<0, magnitude>;
+			using U = typename ResType::underlying_type;
+			using T = details::least_signed_t<B::lower_bound(), magnitude>;
+
+			const auto value = static_cast<T>(b.get());
+			const auto minus = static_cast<T>(-value);
+			return ResType{ static_cast<U>(value < 0 ? minus : value) };
+		}
+	}
+
+	// Element wise forms, out must be at least as long as the input.
+
+	template <bounded Fst, bounded Sec, std::size_t Extent>
+	void min(const std::span<const Fst, Extent> fst, const std::span<const Sec, Extent> sec,
+		const std::span<decltype(cbi::min(std::declval<Fst>(), std::declval<Sec>()))> out) noexcept
+	{
+		assert(fst.size() == sec.size() && out.size() >= fst.size());
+		for (std::size_t i = 0; i < fst.size(); ++i)
+			out[i] = cbi::min(fst[i], sec[i]);
+	}
+
+	template <bounded Fst, bounded Sec, std::size_t Extent>
+	void max(const std::span<const Fst, Extent> fst, const std::span<const Sec, Extent> sec,
+		const std::span<decltype(cbi::max(std::declval<Fst>(), std::declval<Sec>()))> out) noexcept
+	{
+		assert(fst.size() == sec.size() && out.size() >= fst.size());
+		for (std::size_t i = 0; i < fst.size(); ++i)
+			out[i] = cbi::max(fst[i], sec[i]);
+	}
+
+	template <std::intmax_t Lo, std::intmax_t Hi, bounded B, std::size_t Extent>
+	void clamp(const std::span<const B, Extent> values,
+		const std::span<decltype(cbi::clamp<Lo, Hi>(std::declval<B>()))> out) noexcept
+	{
+		assert(out.size() >= values.size());
+		for (std::size_t i = 0; i < values.size(); ++i)
+			out[i] = cbi::clamp<Lo, Hi>(values[i]);
+	}
+
+	template <bounded B, std::size_t Extent>
+	void abs(const std::span<const B, Extent> values,
+		const std::span<decltype(cbi::abs(std::declval<B>()))> out) noexcept
+	{
+		assert(out.size() >= values.size());
+		for (std::size_t i = 0; i < values.size(); ++i)
+			out[i] = cbi::abs(values[i]);
+	}
+}
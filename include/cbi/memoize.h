@@ -0,0 +1,110 @@
+#pragma once
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include "cbi/bounded.h"
+
+namespace cbi
+{
+	namespace details
+	{
+		inline constexpr std::uintmax_t memoize_max_entries = std::uintmax_t{ 1 } << 24;
+	}
+
+	// Lazily filled cache of a pure function over every value of B, one slot per value
+	// indexed by its offset from B::lower_bound(). All slots are allocated up front.
+	//
+	// Slots are filled lock-free: the first caller claims a slot and stores the result,
+	// callers that find the slot being filled compute the value themselves instead of
+	// waiting, and once a slot is ready every read is one acquire load and a copy.
+	template <bounded B, typename F>
+	class memo_cache
+	{
+		static_assert(details::domain_at_most<B>(details::memoize_max_entries), "Domain too wide to memoize");
+		static constexpr std::uintmax_t entries = details::domain_size<B>;
+
+	public:
+		using result_type = std::remove_cvref_t<std::invoke_result_t<const F&, B>>;
+
+		explicit memo_cache(F f) : fn(std::move(f)), slots(std::make_unique<slot[]>(entries)) {}
+
+		memo_cache(const memo_cache&) = delete;
+		memo_cache& operator=(const memo_cache&) = delete;
+
+		~memo_cache()
+		{
+			if constexpr (!std::is_trivially_destructible_v<result_type>)
+			{
+				for (std::size_t i = 0; i < entries; ++i)
+				{
+					if (slots[i].state.load(std::memory_order_acquire) == ready)
+						slots[i].value()->~result_type();
+				}
+			}
+		}
+
+		[[nodiscard]] result_type operator()(const B value) const
+		{
+			slot& entry = slots[details::offset_from(value.get(), B::lower_bound())];
+			std::uint8_t state = entry.state.load(std::memory_order_acquire);
+			if (state == ready)
+				return *entry.value();
+
+			if (state == empty && entry.state.compare_exchange_strong(state, filling, std::memory_order_acquire))
+			{
+				try
+				{
+					::new (static_cast<void*>(entry.storage)) result_type(std::invoke(fn, value));
+				}
+				catch (...)
+				{
+					// release the claim so a later call can fill the slot
+					entry.state.store(empty, std::memory_order_release);
+					throw;
+				}
+				entry.state.store(ready, std::memory_order_release);
+				return *entry.value();
+			}
+
+			// another thread is filling the slot, f is pure so computing it again is just as good
+			return std::invoke(fn, value);
+		}
+
+		// Whether the value for this argument has been stored already.
+		[[nodiscard]] bool contains(const B value) const noexcept
+		{
+			return slots[details::offset_from(value.get(), B::lower_bound())].state.load(std::memory_order_acquire) == ready;
+		}
+
+	private:
+		static constexpr std::uint8_t empty = 0;
+		static constexpr std::uint8_t filling = 1;
+		static constexpr std::uint8_t ready = 2;
+
+		struct slot
+		{
+			std::atomic<std::uint8_t> state{ empty };
+			alignas(result_type) std::byte storage[sizeof(result_type)];
+
+			[[nodiscard]] result_type* value() noexcept
+			{
+				return std::launder(reinterpret_cast<result_type*>(storage));
+			}
+		};
+
+		F fn;
+		std::unique_ptr<slot[]> slots;
+	};
+
+	// Memoizes f over the domain of B, see memo_cache.
+	template <bounded B, typename F>
+	[[nodiscard]] auto memoize(F f)
+	{
+		return memo_cache<B, F>{ std::move(f) };
+	}
+}
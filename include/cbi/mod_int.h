@@ -0,0 +1,235 @@
+#pragma once
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <span>
+#include <utility>
+#include "cbi/bounded.h"
+#include "cbi/wide.h"
+
+namespace cbi
+{
+	namespace details
+	{
+		// Products of two residues must fit 64 bits.
+		inline constexpr std::uint64_t max_modulus = std::uint64_t{ 1 } << 32;
+
+		// Barrett reduction by a fixed modulus: x mod n is x - mul_high(x, floor((2^64 - 1) / n)) * n,
+		// which is below 2n and needs at most one conditional subtract. No hardware division.
+		class barrett
+		{
+		public:
+			constexpr explicit barrett(const std::uint64_t modulus) noexcept
+				: modulus(modulus), factor(std::numeric_limits<std::uint64_t>::max() / modulus)
+			{
+				assert(modulus >= 1 && modulus <= max_modulus);
+			}
+
+			[[nodiscard]] constexpr std::uint64_t reduce(const std::uint64_t value) const noexcept
+			{
+				const std::uint64_t rest = value - mul_high(value, factor) * modulus;
+				return rest >= modulus ? rest - modulus : rest;
+			}
+
+			// Both operands below the modulus.
+			[[nodiscard]] constexpr std::uint64_t add(const std::uint64_t fst, const std::uint64_t sec) const noexcept
+			{
+				const std::uint64_t sum = fst + sec;
+				return sum >= modulus ? sum - modulus : sum;
+			}
+
+			[[nodiscard]] constexpr std::uint64_t sub(const std::uint64_t fst, const std::uint64_t sec) const noexcept
+			{
+				return fst - sec + (fst < sec ? modulus : 0);
+			}
+
+			[[nodiscard]] constexpr std::uint64_t mul(const std::uint64_t fst, const std::uint64_t sec) const noexcept
+			{
+				return reduce(fst * sec);
+			}
+
+			[[nodiscard]] constexpr std::uint64_t get_modulus() const noexcept { return modulus; }
+
+		private:
+			std::uint64_t modulus;
+			std::uint64_t factor;
+		};
+
+		// Any Bounded value as a residue, negative values wrap around.
+		template <bounded B>
+		[[nodiscard]] constexpr std::uint64_t residue_of(const B value, const barrett& reducer) noexcept
+		{
+			if constexpr (std::cmp_greater_equal(B::lower_bound(), 0))
+			{
+				return reducer.reduce(static_cast<std::uint64_t>(value.get()));
+			}
+			else
+			{
+				const std::uint64_t magnitude = reducer.reduce(magnitude_of(value.get()));
+				return value.get() < 0 ? reducer.sub(0, magnitude) : magnitude;
+			}
+		}
+	}
+
+	// Integer modulo the compile time constant N, stored as a Bounded over [0, N - 1].
+	// Sums and differences use a conditional subtract, products a Barrett reduction.
+	template <std::uint64_t N>
+	class mod_int
+	{
+		static_assert(N >= 1 && N <= details::max_modulus, "Modulus out of range");
+		static constexpr details::barrett reducer{ N };
+
+	public:
+		using value_type = Bounded<details::least_unsigned_t<N - 1>, 0, N - 1>;
+		static constexpr std::uint64_t modulus = N;
+
+		constexpr explicit mod_int(const value_type value) noexcept : value(value) {}
+
+		// Reduces any Bounded value, values already inside [0, N - 1] are taken as they are.
+		template <bounded B>
+		[[nodiscard]] static constexpr mod_int from(const B value) noexcept
+		{
+			if constexpr (std::cmp_greater_equal(B::lower_bound(), 0) && std::cmp_less(B::upper_bound(), N))
+				return make(static_cast<std::uint64_t>(value.get()));
+			else
+				return make(details::residue_of(value, reducer));
+		}
+
+		[[nodiscard]] static constexpr mod_int reduce(const std::uint64_t value) noexcept
+		{
+			return make(reducer.reduce(value));
+		}
+
+		// Element wise reduction, out must be at least as long as values.
+		static void reduce(const std::span<const std::uint64_t> values, const std::span<mod_int> out) noexcept
+		{
+			assert(out.size() >= values.size());
+			for (std::size_t i = 0; i < values.size(); ++i)
+				out[i] = reduce(values[i]);
+		}
+
+		[[nodiscard]] constexpr value_type get() const noexcept { return value; }
+
+		[[nodiscard]] friend constexpr mod_int operator+(const mod_int fst, const mod_int sec) noexcept
+		{
+			return make(reducer.add(fst.raw(), sec.raw()));
+		}
+
+		[[nodiscard]] friend constexpr mod_int operator-(const mod_int fst, const mod_int sec) noexcept
+		{
+			return make(reducer.sub(fst.raw(), sec.raw()));
+		}
+
+		[[nodiscard]] friend constexpr mod_int operator-(const mod_int number) noexcept
+		{
+			return make(reducer.sub(0, number.raw()));
+		}
+
+		[[nodiscard]] friend constexpr mod_int operator*(const mod_int fst, const mod_int sec) noexcept
+		{
+			return make(reducer.mul(fst.raw(), sec.raw()));
+		}
+
+		[[nodiscard]] friend constexpr bool operator==(const mod_int fst, const mod_int sec) noexcept
+		{
+			return fst.raw() == sec.raw();
+		}
+
+		// Element wise product, out must be at least as long as the inputs.
+		static void mul(const std::span<const mod_int> fst, const std::span<const mod_int> sec, const std::span<mod_int> out) noexcept
+		{
+			assert(fst.size() == sec.size() && out.size() >= fst.size());
+			for (std::size_t i = 0; i < fst.size(); ++i)
+				out[i] = fst[i] * sec[i];
+		}
+
+	private:
+		[[nodiscard]] static constexpr mod_int make(const std::uint64_t residue) noexcept
+		{
+			return mod_int{ value_type{ static_cast<typename value_type::underlying_type>(residue) } };
+		}
+
+		[[nodiscard]] constexpr std::uint64_t raw() const noexcept { return value.get(); }
+
+		value_type value;
+	};
+
+	// Arithmetic modulo a runtime modulus of at most MaxN. Residues are Bounded over
+	// [0, MaxN - 1]; the reduction constant is computed once on construction.
+	template <std::uint64_t MaxN>
+	class mod_ring
+	{
+		static_assert(MaxN >= 1 && MaxN <= details::max_modulus, "Modulus out of range");
+
+	public:
+		using modulus_type = Bounded<details::least_unsigned_t<MaxN>, 1, MaxN>;
+		using value_type = Bounded<details::least_unsigned_t<MaxN - 1>, 0, MaxN - 1>;
+
+		constexpr explicit mod_ring(const modulus_type modulus) noexcept : reducer(modulus.get()) {}
+
+		[[nodiscard]] constexpr modulus_type modulus() const noexcept
+		{
+			return modulus_type{ static_cast<typename modulus_type::underlying_type>(reducer.get_modulus()) };
+		}
+
+		template <bounded B>
+		[[nodiscard]] constexpr value_type from(const B value) const noexcept
+		{
+			return make(details::residue_of(value, reducer));
+		}
+
+		[[nodiscard]] constexpr value_type reduce(const std::uint64_t value) const noexcept
+		{
+			return make(reducer.reduce(value));
+		}
+
+		// Operands must be residues of this ring, i.e. below modulus().
+		[[nodiscard]] constexpr value_type add(const value_type fst, const value_type sec) const noexcept
+		{
+			assert(fst.get() < reducer.get_modulus() && sec.get() < reducer.get_modulus());
+			return make(reducer.add(fst.get(), sec.get()));
+		}
+
+		[[nodiscard]] constexpr value_type sub(const value_type fst, const value_type sec) const noexcept
+		{
+			assert(fst.get() < reducer.get_modulus() && sec.get() < reducer.get_modulus());
+			return make(reducer.sub(fst.get(), sec.get()));
+		}
+
+		[[nodiscard]] constexpr value_type mul(const value_type fst, const value_type sec) const noexcept
+		{
+			assert(fst.get() < reducer.get_modulus() && sec.get() < reducer.get_modulus());
+			return make(reducer.mul(fst.get(), sec.get()));
+		}
+
+		// Element wise forms, out must be at least as long as the inputs.
+
+		void reduce(const std::span<const std::uint64_t> values, const std::span<value_type> out) const noexcept
+		{
+			assert(out.size() >= values.size());
+			const details::barrett local = reducer;
+			for (std::size_t i = 0; i < values.size(); ++i)
+				out[i] = make(local.reduce(values[i]));
+		}
+
+		void mul(const std::span<const value_type> fst, const std::span<const value_type> sec, const std::span<value_type> out) const noexcept
+		{
+			assert(fst.size() == sec.size() && out.size() >= fst.size());
+			const details::barrett local = reducer;
+			for (std::size_t i = 0; i < fst.size(); ++i)
+			{
+				assert(fst[i].get() < local.get_modulus() && sec[i].get() < local.get_modulus());
+				out[i] = make(local.mul(fst[i].get(), sec[i].get()));
+			}
+		}
+
+	private:
+		[[nodiscard]] static constexpr value_type make(const std::uint64_t residue) noexcept
+		{
+			return value_type{ static_cast<typename value_type::underlying_type>(residue) };
+		}
+
+		details::barrett reducer;
+	};
+}
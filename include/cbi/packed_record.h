@@ -0,0 +1,202 @@
+#pragma once
+#include <array>
+#include <bit>
+#include <compare>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <optional>
+#include <tuple>
+#include <type_traits>
+#include "cbi/bounded.h"
+
+namespace cbi
+{
+	namespace details
+	{
+		template <bounded B>
+		inline constexpr std::size_t field_bits = std::bit_width(unsigned_width(B::lower_bound(), B::upper_bound()));
+
+		template <std::size_t N>
+		struct packed_layout
+		{
+			std::array<std::size_t, N> word{};
+			std::array<std::size_t, N> shift{};
+			// Bits of each word taken by a field, indexed by word; there are never more words than fields.
+			std::array<std::uint64_t, N> used{};
+			std::size_t words = 1;
+			std::size_t bits = 0;
+		};
+
+		// Earlier fields take the higher bits, so comparing the packed words compares
+		// the fields lexicographically. Records wider than one word are split into
+		// 64 bit words without letting a field straddle two of them.
+		template <bounded... Fields>
+		consteval auto make_packed_layout()
+		{
+			constexpr std::array<std::size_t, sizeof...(Fields)> widths{ field_bits<Fields>... };
+			packed_layout<sizeof...(Fields)> layout;
+			for (const std::size_t width : widths)
+				layout.bits += width;
+
+			std::size_t used = 0;
+			for (std::size_t i = 0; i < widths.size(); ++i)
+			{
+				if (layout.bits <= word_bits)
+				{
+					used += widths[i];
+					layout.shift[i] = layout.bits - used;
+					continue;
+				}
+				if (used + widths[i] > word_bits)
+				{
+					++layout.words;
+					used = 0;
+				}
+				used += widths[i];
+				layout.word[i] = layout.words - 1;
+				layout.shift[i] = word_bits - used;
+			}
+			for (std::size_t i = 0; i < widths.size(); ++i)
+			{
+				if (widths[i] != 0)
+					layout.used[layout.word[i]] |= low_mask(widths[i]) << layout.shift[i];
+			}
+			return layout;
+		}
+	}
+
+	// Several Bounded fields packed into one unsigned integer, or an array of 64 bit
+	// words when they don't fit into one. Every field takes bit_width(width()) bits
+	// and is stored as its offset from lower_bound(); a default constructed record
+	// holds the lower bound of every field.
+	template <bounded... Fields>
+	class packed_record
+	{
+		static_assert(sizeof...(Fields) > 0);
+		static constexpr auto layout = details::make_packed_layout<Fields...>();
+
+	public:
+		static constexpr std::size_t bits = layout.bits;
+		static constexpr std::size_t words = layout.words;
+
+		using storage_type = std::conditional_t<words == 1,
+			details::least_unsigned_t<details::low_mask(bits)>,
+			std::array<std::uint64_t, words>>;
+		template <std::size_t I> using field_type = std::tuple_element_t<I, std::tuple<Fields...>>;
+
+		constexpr packed_record() noexcept = default;
+
+		constexpr explicit packed_record(const Fields... values) noexcept
+		{
+			assign(std::index_sequence_for<Fields...>{}, values...);
+		}
+
+		// Validates a raw value, fields of non power of two widths may hold offsets past their
+		// upper bound and bits outside every field, which would break ==, <=> and hashing, must be 0.
+		[[nodiscard]] static constexpr std::optional<packed_record> from_raw(const storage_type raw) noexcept
+		{
+			packed_record res;
+			res.storage = raw;
+			if (!res.valid(std::index_sequence_for<Fields...>{}))
+				return std::nullopt;
+			return std::optional{ res };
+		}
+
+		template <std::size_t I>
+		[[nodiscard]] constexpr field_type<I> get() const noexcept
+		{
+			return details::from_offset<field_type<I>>(field_offset<I>());
+		}
+
+		template <std::size_t I>
+		constexpr void set(const field_type<I> value) noexcept
+		{
+			using F = field_type<I>;
+			constexpr std::uint64_t mask = details::low_mask(details::field_bits<F>);
+			if constexpr (mask != 0)
+			{
+				const std::uint64_t offset = details::offset_from(value.get(), F::lower_bound());
+				auto& target = word<I>();
+				using word_type = std::remove_reference_t<decltype(target)>;
+				target = static_cast<word_type>((target & ~(mask << layout.shift[I])) | (offset << layout.shift[I]));
+			}
+		}
+
+		[[nodiscard]] constexpr storage_type raw() const noexcept { return storage; }
+
+		// Compares the whole record as one integer, which orders it by its fields left to right.
+		friend constexpr bool operator==(const packed_record&, const packed_record&) noexcept = default;
+		friend constexpr auto operator<=>(const packed_record&, const packed_record&) noexcept = default;
+
+	private:
+		template <std::size_t I>
+		[[nodiscard]] constexpr auto& word() noexcept
+		{
+			if constexpr (words == 1) return storage;
+			else return storage[layout.word[I]];
+		}
+
+		template <std::size_t I>
+		[[nodiscard]] constexpr std::uint64_t word() const noexcept
+		{
+			if constexpr (words == 1) return storage;
+			else return storage[layout.word[I]];
+		}
+
+		template <std::size_t I>
+		[[nodiscard]] constexpr std::uint64_t field_offset() const noexcept
+		{
+			constexpr std::uint64_t mask = details::low_mask(details::field_bits<field_type<I>>);
+			if constexpr (mask == 0) return 0;
+			else return (word<I>() >> layout.shift[I]) & mask;
+		}
+
+		template <std::size_t... I>
+		constexpr void assign(std::index_sequence<I...>, const Fields... values) noexcept
+		{
+			(set<I>(values), ...);
+		}
+
+		template <std::size_t... I>
+		[[nodiscard]] constexpr bool valid(std::index_sequence<I...>) const noexcept
+		{
+			if constexpr (words == 1)
+			{
+				if ((storage & ~layout.used[0]) != 0)
+					return false;
+			}
+			else
+			{
+				for (std::size_t i = 0; i < words; ++i)
+				{
+					if ((storage[i] & ~layout.used[i]) != 0)
+						return false;
+				}
+			}
+			return ((field_offset<I>() <= details::unsigned_width(Fields::lower_bound(), Fields::upper_bound())) && ...);
+		}
+
+		storage_type storage{};
+	};
+}
+
+template <cbi::bounded... Fields>
+struct std::hash<cbi::packed_record<Fields...>>
+{
+	[[nodiscard]] std::size_t operator()(const cbi::packed_record<Fields...>& record) const noexcept
+	{
+		if constexpr (cbi::packed_record<Fields...>::words == 1)
+		{
+			return std::hash<typename cbi::packed_record<Fields...>::storage_type>{}(record.raw());
+		}
+		else
+		{
+			std::size_t seed = 0;
+			for (const std::uint64_t word : record.raw())
+				seed ^= std::hash<std::uint64_t>{}(word) + 0x9e3779b97f4a7c15ull + (seed << 6) + (seed >> 2);
+			return seed;
+		}
+	}
+};
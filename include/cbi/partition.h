@@ -0,0 +1,252 @@
+#pragma once
+#include <algorithm>
+#include <bit>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <span>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include "cbi/bounded.h"
+
+namespace cbi
+{
+	namespace details
+	{
+		inline constexpr std::size_t partition_max_bits = 16;
+		inline constexpr std::size_t partition_default_bits = 8;
+		inline constexpr std::size_t write_combine_bytes = cache_line_bytes;
+		inline constexpr std::size_t partition_min_rows_per_thread = std::size_t{ 1 } << 16;
+
+		template <typename KeyFn, typename Row>
+		using key_of_t = std::remove_cvref_t<std::invoke_result_t<KeyFn&, const Row&>>;
+
+		template <typename KeyFn, typename Row>
+		concept key_function = std::invocable<KeyFn&, const Row&> && bounded<key_of_t<KeyFn, Row>>;
+	}
+
+	// Maps keys to partitions by the top Bits bits of their offset from Key::lower_bound().
+	template <bounded Key, std::size_t Bits>
+	struct partition_layout
+	{
+		static_assert(Bits <= details::partition_max_bits, "Too many partitions");
+
+		static constexpr std::uintmax_t width = details::unsigned_width(Key::lower_bound(), Key::upper_bound());
+		static constexpr std::size_t key_bits = std::bit_width(width);
+		static constexpr std::size_t shift = key_bits > Bits ? key_bits - Bits : 0;
+
+		// partitions past the upper bound can never be filled and aren't created
+		[[nodiscard]] static constexpr std::size_t size() noexcept
+		{
+			return static_cast<std::size_t>(width >> shift) + 1;
+		}
+
+		[[nodiscard]] static constexpr std::size_t index_of(const Key key) noexcept
+		{
+			return static_cast<std::size_t>(details::offset_from(key.get(), Key::lower_bound()) >> shift);
+		}
+
+		template <std::size_t I>
+		struct bounds
+		{
+			static_assert(I < size());
+			using U = typename Key::underlying_type;
+			static constexpr std::uintmax_t first = std::uintmax_t{ I } << shift;
+			static constexpr std::uintmax_t last = std::min(width, first + ((std::uintmax_t{ 1 } << shift) - 1));
+			static constexpr U lower_bound = static_cast<U>(static_cast<std::uintmax_t>(Key::lower_bound()) + first);
+			static constexpr U upper_bound = static_cast<U>(static_cast<std::uintmax_t>(Key::lower_bound()) + last);
+		};
+
+		// key type of the I-th partition, with bounds tightened to the keys it can hold
+		template <std::size_t I>
+		using key_type = Bounded<typename Key::underlying_type, bounds<I>::lower_bound, bounds<I>::upper_bound>;
+
+		template <std::size_t I>
+		[[nodiscard]] static constexpr key_type<I> narrow(const Key key) noexcept
+		{
+			return key_type<I>{ key.get() };
+		}
+	};
+
+	template <bounded Key>
+	inline constexpr std::size_t default_partition_bits =
+		std::min(partition_layout<Key, 0>::key_bits, details::partition_default_bits);
+
+	// Rows grouped by partition in one contiguous buffer.
+	template <bounded Key, std::size_t Bits, typename Row>
+	class partitioned
+	{
+	public:
+		using layout = partition_layout<Key, Bits>;
+		template <std::size_t I> using key_type = typename layout::template key_type<I>;
+
+		partitioned(std::vector<Row> rows, std::vector<std::size_t> offsets) noexcept
+			: rows(std::move(rows)), offsets(std::move(offsets))
+		{
+		}
+
+		[[nodiscard]] static constexpr std::size_t size() noexcept { return layout::size(); }
+
+		[[nodiscard]] std::span<const Row> operator[](const std::size_t index) const noexcept
+		{
+			return std::span<const Row>{ rows }.subspan(offsets[index], offsets[index + 1] - offsets[index]);
+		}
+
+		// Calls fn(std::integral_constant<std::size_t, I>, rows) for every partition,
+		// so the body can use key_type<I> for the keys it finds.
+		template <typename Fn>
+		void for_each(Fn&& fn) const
+		{
+			for_each_impl(fn, std::make_index_sequence<size()>{});
+		}
+
+		[[nodiscard]] std::span<const Row> all() const noexcept { return rows; }
+
+	private:
+		template <typename Fn, std::size_t... I>
+		void for_each_impl(Fn& fn, std::index_sequence<I...>) const
+		{
+			(fn(std::integral_constant<std::size_t, I>{}, (*this)[I]), ...);
+		}
+
+		std::vector<Row> rows;
+		std::vector<std::size_t> offsets;
+	};
+
+	namespace details
+	{
+		template <typename Layout, typename Row, typename KeyFn>
+		void partition_histogram(std::span<const Row> rows, KeyFn& key, std::span<std::size_t> counts)
+		{
+			for (const Row& row : rows)
+				++counts[Layout::index_of(std::invoke(key, row))];
+		}
+
+		// Rows are staged per partition in cache line sized buffers and copied
+		// out a full line at a time, so the scatter doesn't touch one output
+		// line per row across all partitions.
+		template <typename Layout, typename Row, typename KeyFn>
+		void partition_scatter(std::span<const Row> rows, KeyFn& key, std::span<std::size_t> cursors, Row* out)
+		{
+			static_assert(std::is_trivially_copyable_v<Row>);
+			constexpr std::size_t buffered = std::max<std::size_t>(1, write_combine_bytes / sizeof(Row));
+			constexpr std::size_t buffer_bytes = buffered * sizeof(Row);
+
+			struct alignas(write_combine_bytes) buffer
+			{
+				std::byte data[buffer_bytes];
+			};
+			std::vector<buffer> buffers(Layout::size());
+			std::vector<std::uint8_t> fill(Layout::size());
+
+			for (const Row& row : rows)
+			{
+				const std::size_t index = Layout::index_of(std::invoke(key, row));
+				std::memcpy(buffers[index].data + fill[index] * sizeof(Row), &row, sizeof(Row));
+				if (++fill[index] == buffered)
+				{
+					std::memcpy(out + cursors[index], buffers[index].data, buffer_bytes);
+					cursors[index] += buffered;
+					fill[index] = 0;
+				}
+			}
+
+			// empty buffers are skipped, out is null when there are no rows at all
+			for (std::size_t index = 0; index < Layout::size(); ++index)
+			{
+				if (fill[index] == 0)
+					continue;
+				std::memcpy(out + cursors[index], buffers[index].data, fill[index] * sizeof(Row));
+				cursors[index] += fill[index];
+			}
+		}
+	}
+
+	// Scatters rows into 2^Bits partitions (fewer when the key domain is narrower) by the
+	// top bits of their key. With several threads every thread histograms its slice first,
+	// then scatters into its own disjoint ranges of the output.
+	template <std::size_t Bits, typename Row, typename KeyFn>
+		requires details::key_function<KeyFn, Row>
+	[[nodiscard]] auto partition(std::span<const Row> rows, KeyFn key, std::size_t threads = 1)
+	{
+		using Key = details::key_of_t<KeyFn, Row>;
+		using layout = partition_layout<Key, Bits>;
+		constexpr std::size_t parts = layout::size();
+
+		threads = std::clamp<std::size_t>(rows.size() / details::partition_min_rows_per_thread, 1, std::max<std::size_t>(threads, 1));
+		const std::size_t chunk = (rows.size() + threads - 1) / threads;
+		const auto slice = [&](const std::size_t t)
+		{
+			const std::size_t first = std::min(t * chunk, rows.size());
+			return rows.subspan(first, std::min(chunk, rows.size() - first));
+		};
+
+		// cursors[t * parts + p] is where thread t writes its next row of partition p
+		std::vector<std::size_t> cursors(threads * parts);
+		const auto run = [&](auto&& step)
+		{
+			if (threads == 1)
+			{
+				step(0);
+				return;
+			}
+			std::vector<std::jthread> workers;
+			workers.reserve(threads);
+			for (std::size_t t = 0; t < threads; ++t)
+				workers.emplace_back(step, t);
+		};
+
+		run([&](const std::size_t t)
+		{
+			KeyFn local = key;
+			details::partition_histogram<layout>(slice(t), local, std::span{ cursors }.subspan(t * parts, parts));
+		});
+
+		std::vector<std::size_t> offsets(parts + 1);
+		std::size_t sum = 0;
+		for (std::size_t p = 0; p < parts; ++p)
+		{
+			offsets[p] = sum;
+			for (std::size_t t = 0; t < threads; ++t)
+				sum += std::exchange(cursors[t * parts + p], sum);
+		}
+		offsets[parts] = sum;
+
+		// Row may lack a default constructor (Bounded does), every slot gets overwritten anyway
+		std::vector<Row> out;
+		if (!rows.empty())
+			out.assign(rows.size(), rows.front());
+
+		run([&](const std::size_t t)
+		{
+			KeyFn local = key;
+			details::partition_scatter<layout>(slice(t), local, std::span{ cursors }.subspan(t * parts, parts), out.data());
+		});
+
+		return partitioned<Key, Bits, Row>{ std::move(out), std::move(offsets) };
+	}
+
+	template <typename Row, typename KeyFn>
+		requires details::key_function<KeyFn, Row>
+	[[nodiscard]] auto partition(std::span<const Row> rows, KeyFn key, std::size_t threads = 1)
+	{
+		using Key = details::key_of_t<KeyFn, Row>;
+		return partition<default_partition_bits<Key>>(rows, std::move(key), threads);
+	}
+
+	template <std::size_t Bits, bounded Key>
+	[[nodiscard]] auto partition(std::span<const Key> keys, std::size_t threads = 1)
+	{
+		return partition<Bits>(keys, std::identity{}, threads);
+	}
+
+	template <bounded Key>
+	[[nodiscard]] auto partition(std::span<const Key> keys, std::size_t threads = 1)
+	{
+		return partition<default_partition_bits<Key>>(keys, std::identity{}, threads);
+	}
+}
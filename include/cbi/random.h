@@ -0,0 +1,171 @@
+#pragma once
+#include <bit>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <random>
+#include <span>
+#include <type_traits>
+#include "cbi/bounded.h"
+#include "cbi/wide.h"
+
+namespace cbi
+{
+	namespace details
+	{
+		// Generators producing full 32 or 64 bit words, e.g. std::mt19937 and std::mt19937_64.
+		template <typename G>
+		concept word_generator = std::uniform_random_bit_generator<G> && G::min() == 0 &&
+			(G::max() == std::numeric_limits<std::uint32_t>::max() || G::max() == std::numeric_limits<std::uint64_t>::max());
+
+		// Keeps the rejection chance of a batched draw below 2^-8.
+		inline constexpr std::uint64_t max_batch_product = std::uint64_t{ 1 } << 56;
+
+		template <bounded B>
+		inline constexpr std::uintmax_t random_width = unsigned_width(B::lower_bound(), B::upper_bound());
+
+		// 32 bit words are enough when the generator produces them and the range fits.
+		template <typename G, std::uintmax_t Width>
+		using random_word_t = std::conditional_t<G::max() == std::numeric_limits<std::uint32_t>::max() &&
+			Width <= std::numeric_limits<std::uint32_t>::max(), std::uint32_t, std::uint64_t>;
+
+		template <typename Word, word_generator G>
+		[[nodiscard]] Word draw_word(G& rng)
+		{
+			if constexpr (G::max() >= std::numeric_limits<Word>::max())
+				return static_cast<Word>(rng());
+			else
+			{
+				const std::uint64_t high = rng();
+				return (high << 32) | rng();
+			}
+		}
+
+		// word * range split into the high half, uniform over [0, range), and the low half.
+		template <typename Word>
+		[[nodiscard]] constexpr Word split_product(const Word word, const Word range, Word& low) noexcept
+		{
+			if constexpr (sizeof(Word) == sizeof(std::uint32_t))
+			{
+				const std::uint64_t product = std::uint64_t{ word } * range;
+				low = static_cast<Word>(product);
+				return static_cast<Word>(product >> 32);
+			}
+			else
+			{
+				low = word * range;
+				return mul_high(word, range);
+			}
+		}
+
+		// Lemire's nearly divisionless method: the high half of word * range is uniform once
+		// low halves below 2^bits mod range are rejected. That threshold needs a division,
+		// but only when the low half lands below range, which is rare for small ranges.
+		template <typename Word, word_generator G>
+		[[nodiscard]] Word draw_below(G& rng, const Word range)
+		{
+			Word low;
+			Word res = split_product(draw_word<Word>(rng), range, low);
+			if (low < range)
+			{
+				const Word threshold = static_cast<Word>(0 - range) % range;
+				while (low < threshold)
+					res = split_product(draw_word<Word>(rng), range, low);
+			}
+			return res;
+		}
+
+		// Largest count such that Range^count stays within max_batch_product, at least 1.
+		[[nodiscard]] constexpr std::size_t batch_count(const std::uint64_t range) noexcept
+		{
+			std::size_t count = 1;
+			for (std::uint64_t product = range; product <= max_batch_product / range; product *= range)
+				++count;
+			return count;
+		}
+
+		[[nodiscard]] constexpr std::uint64_t batch_product(const std::uint64_t range, const std::size_t count) noexcept
+		{
+			std::uint64_t res = 1;
+			for (std::size_t i = 0; i < count; ++i)
+				res *= range;
+			return res;
+		}
+	}
+
+	// Uniformly distributed value over [B::lower_bound(), B::upper_bound()]. Power of two
+	// widths take the low bits of one word, all others use Lemire's method specialised for
+	// the width at compile time.
+	template <bounded B, details::word_generator G>
+	[[nodiscard]] B uniform(G& rng)
+	{
+		constexpr std::uintmax_t width = details::random_width<B>;
+		using Word = details::random_word_t<G, width>;
+
+		if constexpr (width == 0)
+			return B{ static_cast<typename B::underlying_type>(B::lower_bound()) };
+		else if constexpr (std::has_single_bit(width + 1) || width == std::numeric_limits<std::uintmax_t>::max())
+			return details::from_offset<B>(details::draw_word<Word>(rng) & static_cast<Word>(width));
+		else
+			return details::from_offset<B>(details::draw_below<Word>(rng, static_cast<Word>(width + 1)));
+	}
+
+	// Fills out with uniformly distributed values. Narrow power of two widths cut several
+	// values out of every 64 bit word. Other small widths draw a batch of values from one
+	// word: each multiply by the range yields a value in the high half and leaves the rest
+	// of the randomness in the low half for the next one. A single rejection test on the
+	// final low half against the product of the ranges keeps the batch exactly uniform.
+	template <bounded B, details::word_generator G>
+	void uniform(G& rng, const std::span<B> out)
+	{
+		constexpr std::uintmax_t width = details::random_width<B>;
+
+		if constexpr (width == 0)
+		{
+			for (B& value : out)
+				value = B{ static_cast<typename B::underlying_type>(B::lower_bound()) };
+		}
+		else if constexpr (std::has_single_bit(width + 1) && std::bit_width(width) <= details::word_bits / 2)
+		{
+			constexpr std::size_t bits = std::bit_width(width);
+			constexpr std::size_t per_word = details::word_bits / bits;
+
+			std::size_t i = 0;
+			for (; i + per_word <= out.size(); i += per_word)
+			{
+				std::uint64_t word = details::draw_word<std::uint64_t>(rng);
+				for (std::size_t j = 0; j < per_word; ++j, word >>= bits)
+					out[i + j] = details::from_offset<B>(word & width);
+			}
+			for (; i < out.size(); ++i)
+				out[i] = uniform<B>(rng);
+		}
+		else if constexpr (width < details::max_batch_product && details::batch_count(width + 1) > 1)
+		{
+			constexpr std::uint64_t range = width + 1;
+			constexpr std::size_t per_word = details::batch_count(range);
+			constexpr std::uint64_t product = details::batch_product(range, per_word);
+			constexpr std::uint64_t threshold = (0 - product) % product;
+
+			std::size_t i = 0;
+			for (; i + per_word <= out.size(); i += per_word)
+			{
+				std::uint64_t low;
+				do
+				{
+					low = details::draw_word<std::uint64_t>(rng);
+					for (std::size_t j = 0; j < per_word; ++j)
+						out[i + j] = details::from_offset<B>(details::split_product(low, range, low));
+				} while (low < threshold);
+			}
+			for (; i < out.size(); ++i)
+				out[i] = uniform<B>(rng);
+		}
+		else
+		{
+			for (B& value : out)
+				value = uniform<B>(rng);
+		}
+	}
+}
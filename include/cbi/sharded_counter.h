@@ -0,0 +1,120 @@
+#pragma once
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <utility>
+#include "cbi/bounded.h"
+
+namespace cbi
+{
+	// Counter split into one cache line per thread. Every shard is a B that only its
+	// registered thread writes, so updates are a plain load and store without a locked
+	// instruction. Reads sum all shards into result_type, whose bounds are
+	// Threads times those of B, so the merge can't overflow.
+	template <bounded B, std::size_t Threads, overflow_policy Policy = overflow_policy::saturate>
+	class sharded_counter
+	{
+		static_assert(Threads > 0);
+		static_assert(B::lower_bound() <= 0 && 0 <= B::upper_bound(), "Shards start at zero");
+
+		static constexpr auto low = details::limited_mul(B::lower_bound(), static_cast<std::intmax_t>(Threads));
+		static constexpr auto high = details::limited_mul(B::upper_bound(), static_cast<std::intmax_t>(Threads));
+		static_assert(low.has_value() && high.has_value(), "Possible overflow detected!");
+
+		static constexpr std::uintmax_t width = details::unsigned_width(B::lower_bound(), B::upper_bound());
+		using U = typename B::underlying_type;
+
+		struct alignas(details::cache_line_bytes) shard
+		{
+			std::atomic<U> value{ 0 };
+			std::atomic<bool> taken{ false };
+		};
+
+	public:
+		using value_type = B;
+		using result_type = Bounded<details::least_signed_t<*low, *high>, *low, *high>;
+
+		// Write access to one shard, released when the handle is destroyed.
+		class handle
+		{
+		public:
+			handle(handle&& other) noexcept : slot(std::exchange(other.slot, nullptr)) {}
+			handle& operator=(handle&&) = delete;
+			~handle()
+			{
+				if (slot) slot->taken.store(false, std::memory_order_release);
+			}
+
+			// Returns false when the delta couldn't be applied in full
+			// (saturated or rejected, depending on the policy).
+			template <bounded D>
+			bool add(const D delta) noexcept
+			{
+				return step(details::magnitude_of(delta.get()), delta.get() < 0);
+			}
+
+			template <bounded D>
+			bool sub(const D delta) noexcept
+			{
+				return step(details::magnitude_of(delta.get()), delta.get() > 0);
+			}
+
+			[[nodiscard]] B get() const noexcept
+			{
+				return B{ slot->value.load(std::memory_order_relaxed) };
+			}
+
+		private:
+			friend class sharded_counter;
+			explicit handle(shard* slot) noexcept : slot(slot) {}
+
+			bool step(const std::uintmax_t magnitude, const bool negative) noexcept
+			{
+				const U current = slot->value.load(std::memory_order_relaxed);
+				const std::uintmax_t offset = details::offset_from(current, B::lower_bound());
+				const auto exact = details::limited_step(offset, width, magnitude, negative);
+				const auto next = details::policy_step<Policy>(offset, width, magnitude, negative);
+				if (next)
+					slot->value.store(details::from_offset<B>(*next).get(), std::memory_order_relaxed);
+				return exact.has_value() || Policy == overflow_policy::wrap;
+			}
+
+			shard* slot;
+		};
+
+		sharded_counter() = default;
+		sharded_counter(const sharded_counter&) = delete;
+		sharded_counter& operator=(const sharded_counter&) = delete;
+
+		// Claims a free shard for the calling thread, std::nullopt when all Threads are taken.
+		// A released shard keeps its value and is handed to the next thread that registers.
+		[[nodiscard]] std::optional<handle> register_thread() noexcept
+		{
+			for (shard& slot : shards)
+			{
+				bool expected = false;
+				if (!slot.taken.load(std::memory_order_relaxed) &&
+					slot.taken.compare_exchange_strong(expected, true, std::memory_order_acquire))
+					return std::optional<handle>{ handle{ &slot } };
+			}
+			return std::nullopt;
+		}
+
+		// Sums the shards. Every shard always holds a valid B, so a read that overlaps
+		// with updates sees each shard either before or after its latest update.
+		[[nodiscard]] result_type read() const noexcept
+		{
+			typename result_type::underlying_type sum = 0;
+			for (const shard& slot : shards)
+				sum += slot.value.load(std::memory_order_relaxed);
+			return result_type{ sum };
+		}
+
+		[[nodiscard]] static constexpr std::size_t size() noexcept { return Threads; }
+
+	private:
+		std::array<shard, Threads> shards;
+	};
+}
@@ -0,0 +1,229 @@
+#pragma once
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include "cbi/bounded.h"
+#include "cbi/packed_record.h"
+
+namespace cbi
+{
+	// Column tag: store B in bit_width(width()) bits per row instead of a whole B.
+	template <bounded B>
+	struct bit_packed
+	{
+		using value_type = B;
+	};
+
+	// Contiguous column of B offsets, each bit_width(width()) bits wide. Values may straddle words.
+	template <bounded B>
+	class packed_column
+	{
+		static constexpr std::size_t bits = details::field_bits<B>;
+		static constexpr std::uint64_t mask = details::low_mask(bits);
+
+	public:
+		using value_type = B;
+
+		[[nodiscard]] std::size_t size() const noexcept { return count; }
+
+		void reserve(const std::size_t rows)
+		{
+			words.reserve(word_count(rows));
+		}
+
+		[[nodiscard]] B operator[](const std::size_t index) const noexcept
+		{
+			if constexpr (bits == 0)
+			{
+				return details::from_offset<B>(0);
+			}
+			else
+			{
+				const std::size_t bit = index * bits;
+				const std::size_t word = bit / details::word_bits;
+				const std::size_t shift = bit % details::word_bits;
+				std::uint64_t offset = words[word] >> shift;
+				if (shift + bits > details::word_bits)
+					offset |= words[word + 1] << (details::word_bits - shift);
+				return details::from_offset<B>(offset & mask);
+			}
+		}
+
+		void set(const std::size_t index, const B value) noexcept
+		{
+			if constexpr (bits != 0)
+			{
+				const std::uint64_t offset = details::offset_from(value.get(), B::lower_bound());
+				const std::size_t bit = index * bits;
+				const std::size_t word = bit / details::word_bits;
+				const std::size_t shift = bit % details::word_bits;
+				words[word] = (words[word] & ~(mask << shift)) | (offset << shift);
+				if (shift + bits > details::word_bits)
+				{
+					const std::size_t spilled = details::word_bits - shift;
+					words[word + 1] = (words[word + 1] & ~(mask >> spilled)) | (offset >> spilled);
+				}
+			}
+		}
+
+		void push_back(const B value)
+		{
+			words.resize(word_count(count + 1));
+			set(count++, value);
+		}
+
+	private:
+		[[nodiscard]] static constexpr std::size_t word_count(const std::size_t rows) noexcept
+		{
+			return (rows * bits + details::word_bits - 1) / details::word_bits;
+		}
+
+		std::vector<std::uint64_t> words;
+		std::size_t count = 0;
+	};
+
+	namespace details
+	{
+		template <typename Column>
+		struct column_traits
+		{
+			using value_type = Column;
+			using storage_type = std::vector<Column>;
+		};
+
+		template <bounded B>
+		struct column_traits<bit_packed<B>>
+		{
+			using value_type = B;
+			using storage_type = packed_column<B>;
+		};
+
+		// Branchless range check over a whole buffer, one unsigned compare per value.
+		template <bounded B>
+		[[nodiscard]] bool all_in_bounds(const std::span<const typename B::underlying_type> raw) noexcept
+		{
+			using unsigned_type = std::make_unsigned_t<typename B::underlying_type>;
+			constexpr auto lower = static_cast<unsigned_type>(B::lower_bound());
+			constexpr auto width = static_cast<unsigned_type>(unsigned_width(B::lower_bound(), B::upper_bound()));
+
+			bool out_of_bounds = false;
+			for (const auto value : raw)
+				out_of_bounds |= static_cast<unsigned_type>(static_cast<unsigned_type>(value) - lower) > width;
+			return !out_of_bounds;
+		}
+	}
+
+	// Structure of arrays table, one contiguous array per column. A column is either a
+	// Bounded type, stored as a plain array that the batch kernels take as a span, or
+	// bit_packed<Bounded>, stored in bit_width(width()) bits per row.
+	template <typename... Columns>
+	class soa_table
+	{
+		using storage = std::tuple<typename details::column_traits<Columns>::storage_type...>;
+
+		template <typename Table>
+		class basic_row
+		{
+		public:
+			basic_row(Table& table, const std::size_t index) noexcept : table(&table), index(index) {}
+
+			template <std::size_t I>
+			[[nodiscard]] auto get() const noexcept
+			{
+				return std::get<I>(table->columns)[index];
+			}
+
+			template <std::size_t I>
+				requires (!std::is_const_v<Table>)
+			void set(const typename Table::template value_type<I> value) const noexcept
+			{
+				auto& column = std::get<I>(table->columns);
+				if constexpr (requires { column.set(index, value); })
+					column.set(index, value);
+				else
+					column[index] = value;
+			}
+
+		private:
+			Table* table;
+			std::size_t index;
+		};
+
+	public:
+		template <std::size_t I>
+		using value_type = typename details::column_traits<std::tuple_element_t<I, std::tuple<Columns...>>>::value_type;
+		using row_reference = basic_row<soa_table>;
+		using const_row_reference = basic_row<const soa_table>;
+
+		[[nodiscard]] std::size_t size() const noexcept { return std::get<0>(columns).size(); }
+
+		void reserve(const std::size_t rows)
+		{
+			std::apply([rows](auto&... column) { (column.reserve(rows), ...); }, columns);
+		}
+
+		void append(const typename details::column_traits<Columns>::value_type... values)
+		{
+			append_impl(std::index_sequence_for<Columns...>{}, values...);
+		}
+
+		[[nodiscard]] row_reference operator[](const std::size_t index) noexcept { return { *this, index }; }
+		[[nodiscard]] const_row_reference operator[](const std::size_t index) const noexcept { return { *this, index }; }
+
+		// A span for plain columns, the packed_column itself for bit_packed ones.
+		template <std::size_t I>
+		[[nodiscard]] decltype(auto) column() const noexcept
+		{
+			const auto& column = std::get<I>(columns);
+			if constexpr (std::is_same_v<std::remove_cvref_t<decltype(column)>, std::vector<value_type<I>>>)
+				return std::span<const value_type<I>>{ column };
+			else
+				return column;
+		}
+
+		// Appends rows column by column from raw buffers of equal length. Every buffer is
+		// range checked before anything is appended; returns false and leaves the table
+		// untouched when any value is out of bounds.
+		bool append_raw(const std::span<const typename details::column_traits<Columns>::value_type::underlying_type>... raw)
+		{
+			const std::size_t rows = std::get<0>(std::tie(raw...)).size();
+			assert(((raw.size() == rows) && ...));
+
+			if (!(details::all_in_bounds<typename details::column_traits<Columns>::value_type>(raw) && ...))
+				return false;
+
+			reserve(size() + rows);
+			append_raw_impl(std::index_sequence_for<Columns...>{}, raw...);
+			return true;
+		}
+
+	private:
+		template <std::size_t... I>
+		void append_impl(std::index_sequence<I...>, const typename details::column_traits<Columns>::value_type... values)
+		{
+			(std::get<I>(columns).push_back(values), ...);
+		}
+
+		template <std::size_t... I>
+		void append_raw_impl(std::index_sequence<I...>,
+			const std::span<const typename details::column_traits<Columns>::value_type::underlying_type>... raw)
+		{
+			(append_column<I>(raw), ...);
+		}
+
+		template <std::size_t I>
+		void append_column(const std::span<const typename value_type<I>::underlying_type> raw)
+		{
+			auto& column = std::get<I>(columns);
+			for (const auto value : raw)
+				column.push_back(value_type<I>{ value });
+		}
+
+		storage columns;
+	};
+}
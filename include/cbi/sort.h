@@ -0,0 +1,132 @@
+#pragma once
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <utility>
+#include <vector>
+#include "cbi/bounded.h"
+
+namespace cbi
+{
+	enum class sort_algorithm
+	{
+		counting,
+		radix,
+		comparison
+	};
+
+	namespace details
+	{
+		inline constexpr std::uintmax_t counting_sort_max_width = (std::uintmax_t{ 1 } << 16) - 1;
+		inline constexpr int radix_max_key_bits = 32;
+		inline constexpr int radix_max_digit_bits = 11;
+
+		template <bounded B>
+		consteval sort_algorithm pick_sort_algorithm()
+		{
+			constexpr auto width = unsigned_width(B::lower_bound(), B::upper_bound());
+			if constexpr (width <= counting_sort_max_width) return sort_algorithm::counting;
+			else if constexpr (std::bit_width(width) <= radix_max_key_bits) return sort_algorithm::radix;
+			else return sort_algorithm::comparison;
+		}
+
+		template <bounded B>
+		consteval int radix_key_bits()
+		{
+			return static_cast<int>(std::bit_width(unsigned_width(B::lower_bound(), B::upper_bound())));
+		}
+
+		// fewest passes of at most radix_max_digit_bits, with the key bits spread evenly over them
+		template <bounded B>
+		consteval int radix_passes()
+		{
+			return (radix_key_bits<B>() + radix_max_digit_bits - 1) / radix_max_digit_bits;
+		}
+
+		template <bounded B>
+		consteval int radix_digit_bits()
+		{
+			return (radix_key_bits<B>() + radix_passes<B>() - 1) / radix_passes<B>();
+		}
+
+		template <bounded B>
+		void counting_sort(std::span<B> values)
+		{
+			constexpr auto buckets = unsigned_width(B::lower_bound(), B::upper_bound()) + 1;
+
+			std::vector<std::size_t> counts(buckets);
+			for (const B value : values)
+				++counts[offset_from(value.get(), B::lower_bound())];
+
+			auto out = values.begin();
+			for (std::size_t i = 0; i < buckets; ++i)
+				out = std::fill_n(out, counts[i], from_offset<B>(i));
+		}
+
+		template <bounded B>
+		void radix_sort(std::span<B> values)
+		{
+			constexpr int passes = radix_passes<B>();
+			constexpr int digit_bits = radix_digit_bits<B>();
+			constexpr std::size_t radix = std::size_t{ 1 } << digit_bits;
+			constexpr std::uint32_t mask = radix - 1;
+
+			const std::size_t size = values.size();
+			std::vector<std::uint32_t> keys(size);
+			std::vector<std::uint32_t> scratch(size);
+			std::vector<std::array<std::size_t, radix>> counts(passes);
+
+			// a single read of the input builds the histograms of every pass
+			for (std::size_t i = 0; i < size; ++i)
+			{
+				const auto key = static_cast<std::uint32_t>(offset_from(values[i].get(), B::lower_bound()));
+				keys[i] = key;
+				for (int pass = 0; pass < passes; ++pass)
+					++counts[pass][(key >> (pass * digit_bits)) & mask];
+			}
+
+			for (int pass = 0; pass < passes; ++pass)
+			{
+				auto& count = counts[pass];
+				const int shift = pass * digit_bits;
+
+				// every key shares this digit, the pass wouldn't move anything
+				if (count[(keys[0] >> shift) & mask] == size)
+					continue;
+
+				std::size_t sum = 0;
+				for (auto& c : count)
+					sum += std::exchange(c, sum);
+
+				for (const std::uint32_t key : keys)
+					scratch[count[(key >> shift) & mask]++] = key;
+				keys.swap(scratch);
+			}
+
+			for (std::size_t i = 0; i < size; ++i)
+				values[i] = from_offset<B>(keys[i]);
+		}
+	}
+
+	template <bounded B>
+	inline constexpr sort_algorithm sort_algorithm_for = details::pick_sort_algorithm<B>();
+
+	// Sorts ascending. The algorithm is picked from the width of B:
+	// a counting sort for small domains, an LSD radix sort for medium ones and std::sort otherwise.
+	template <bounded B>
+	void sort(std::span<B> values)
+	{
+		if (values.size() < 2)
+			return;
+
+		if constexpr (sort_algorithm_for<B> == sort_algorithm::counting)
+			details::counting_sort(values);
+		else if constexpr (sort_algorithm_for<B> == sort_algorithm::radix)
+			details::radix_sort(values);
+		else
+			std::sort(values.begin(), values.end());
+	}
+}
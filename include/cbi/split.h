@@ -0,0 +1,100 @@
+#pragma once
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+#include <type_traits>
+#include <utility>
+#include "cbi/bounded.h"
+
+namespace cbi
+{
+	namespace details
+	{
+		template <typename Fst, typename Sec>
+		struct common_result
+		{
+			using type = std::common_type_t<Fst, Sec>;
+		};
+
+		template <typename T>
+		struct common_result<T, T>
+		{
+			using type = T;
+		};
+
+		// two different Bounded results meet in the union of their bounds
+		template <bounded Fst, bounded Sec>
+			requires (!std::is_same_v<Fst, Sec>)
+		struct common_result<Fst, Sec>
+		{
+			static constexpr std::intmax_t lower_bound = std::min<std::intmax_t>(Fst::lower_bound(), Sec::lower_bound());
+			static constexpr std::intmax_t upper_bound = std::max<std::intmax_t>(Fst::upper_bound(), Sec::upper_bound());
+			using type = least_bounded_t<lower_bound, upper_bound>;
+		};
+
+		template <typename R, typename T>
+		[[nodiscard]] constexpr R convert_result(T&& value)
+		{
+			if constexpr (bounded<R> && bounded<std::remove_cvref_t<T>>)
+				return R{ static_cast<typename R::underlying_type>(value.get()) };
+			else
+				return static_cast<R>(std::forward<T>(value));
+		}
+	}
+
+	// Compares b against Pivot once and calls small_fn with b re-typed to [lower_bound(), Pivot - 1]
+	// or large_fn with b re-typed to [Pivot, upper_bound()]. When the bounds of B already decide
+	// the comparison only the reachable function is called. Different Bounded results are
+	// returned as a Bounded over the union of their bounds.
+	template <std::intmax_t Pivot, bounded B, typename SmallFn, typename LargeFn>
+	constexpr decltype(auto) split(const B b, SmallFn&& small_fn, LargeFn&& large_fn)
+	{
+		using U = typename B::underlying_type;
+
+		if constexpr (std::cmp_less_equal(Pivot, B::lower_bound()))
+		{
+			return std::invoke(large_fn, b);
+		}
+		else if constexpr (std::cmp_greater(Pivot, B::upper_bound()))
+		{
+			return std::invoke(small_fn, b);
+		}
+		else
+		{
+			using small_type = Bounded<U, B::lower_bound(), static_cast<U>(Pivot - 1)>;
+			using large_type = Bounded<U, static_cast<U>(Pivot), B::upper_bound()>;
+			using small_result = std::invoke_result_t<SmallFn&, small_type>;
+			using large_result = std::invoke_result_t<LargeFn&, large_type>;
+
+			if constexpr (std::is_void_v<small_result> && std::is_void_v<large_result>)
+			{
+				if (std::cmp_less(b.get(), Pivot))
+					std::invoke(small_fn, small_type{ b.get() });
+				else
+					std::invoke(large_fn, large_type{ b.get() });
+			}
+			else
+			{
+				using result_type = typename details::common_result<
+					std::remove_cvref_t<small_result>, std::remove_cvref_t<large_result>>::type;
+				if (std::cmp_less(b.get(), Pivot))
+					return details::convert_result<result_type>(std::invoke(small_fn, small_type{ b.get() }));
+				return details::convert_result<result_type>(std::invoke(large_fn, large_type{ b.get() }));
+			}
+		}
+	}
+
+	// Multi-way split over ascending pivots: fns[i] gets the values in [Pivots[i-1], Pivots[i] - 1].
+	// The comparisons are made in order, put the most likely range first.
+	template <std::intmax_t Pivot, std::intmax_t Next, std::intmax_t... Pivots, bounded B, typename Fn, typename... Fns>
+	constexpr decltype(auto) split(const B b, Fn&& fn, Fns&&... fns)
+	{
+		static_assert(sizeof...(Fns) == sizeof...(Pivots) + 2, "Expected one function more than pivots");
+		static_assert(Pivot < Next, "Pivots must be ascending");
+
+		return split<Pivot>(b, fn, [&](const auto rest) -> decltype(auto)
+		{
+			return split<Next, Pivots...>(rest, fns...);
+		});
+	}
+}
@@ -0,0 +1,152 @@
+#pragma once
+#include <algorithm>
+#include <array>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include "cbi/bounded.h"
+
+namespace cbi
+{
+	namespace details
+	{
+		inline constexpr std::uintmax_t tabulate_max_entries = std::uintmax_t{ 1 } << 16;
+
+		// Multiplies one domain size at a time, each only after checking it fits in what the
+		// table has left, so the product can't overflow.
+		template <bounded... Args>
+		[[nodiscard]] consteval bool fits_table() noexcept
+		{
+			std::uintmax_t size = 1;
+			return ((domain_at_most<Args>(tabulate_max_entries / size) && (size *= domain_size<Args>) != 0) && ...);
+		}
+
+		template <bounded... Args>
+		inline constexpr std::size_t table_size = static_cast<std::size_t>((domain_size<Args> * ...));
+
+		// row major: the last argument varies fastest
+		template <bounded... Args>
+		[[nodiscard]] constexpr std::size_t table_index(const Args... args) noexcept
+		{
+			std::size_t index = 0;
+			((index = index * domain_size<Args> + offset_from(args.get(), Args::lower_bound())), ...);
+			return index;
+		}
+
+		template <bounded... Args, std::size_t... I>
+		[[nodiscard]] constexpr std::tuple<Args...> table_args(std::size_t index, std::index_sequence<I...>) noexcept
+		{
+			constexpr std::array<std::uintmax_t, sizeof...(Args)> sizes{ domain_size<Args>... };
+			std::array<std::uintmax_t, sizeof...(Args)> offsets{};
+			for (std::size_t i = sizeof...(Args); i-- > 0;)
+			{
+				offsets[i] = index % sizes[i];
+				index /= sizes[i];
+			}
+			return std::tuple<Args...>{ from_offset<Args>(offsets[I])... };
+		}
+
+		template <bounded... Args>
+		[[nodiscard]] constexpr std::tuple<Args...> table_args(const std::size_t index) noexcept
+		{
+			return table_args<Args...>(index, std::index_sequence_for<Args...>{});
+		}
+
+		template <typename R>
+		concept integer_like = std::integral<R> || bounded<R>;
+
+		template <typename R>
+		[[nodiscard]] constexpr std::intmax_t raw_of(const R value) noexcept
+		{
+			if constexpr (bounded<R>) return value.get();
+			else return static_cast<std::intmax_t>(value);
+		}
+
+		// a captureless lambda or function object that can be called in a constant expression
+		template <typename F, typename... Args>
+		concept constant_invocable = std::is_empty_v<F> && std::default_initializable<F> &&
+			requires { typename std::integral_constant<bool, (std::apply(F{}, table_args<Args...>(0)), true)>; };
+
+		template <typename F, bounded... Args>
+		consteval auto evaluate_all()
+		{
+			std::array<std::intmax_t, table_size<Args...>> res{};
+			for (std::size_t i = 0; i < res.size(); ++i)
+				res[i] = raw_of(std::apply(F{}, table_args<Args...>(i)));
+			return res;
+		}
+	}
+
+	// Table of F over every combination of Args, filled at compile time. The element type is
+	// a Bounded over exactly the range of values F produced.
+	template <typename F, bounded... Args>
+	class constant_lookup_table
+	{
+		static constexpr auto raw = details::evaluate_all<F, Args...>();
+		static constexpr std::intmax_t low = *std::min_element(raw.begin(), raw.end());
+		static constexpr std::intmax_t high = *std::max_element(raw.begin(), raw.end());
+
+		static constexpr auto narrow()
+		{
+			std::array<details::least_signed_t<low, high>, raw.size()> res{};
+			for (std::size_t i = 0; i < raw.size(); ++i)
+				res[i] = static_cast<details::least_signed_t<low, high>>(raw[i]);
+			return res;
+		}
+
+	public:
+		using result_type = Bounded<details::least_signed_t<low, high>, low, high>;
+		static constexpr auto values = narrow();
+
+		[[nodiscard]] constexpr result_type operator()(const Args... args) const noexcept
+		{
+			return result_type{ values[details::table_index(args...)] };
+		}
+	};
+
+	// Table of R over every combination of Args, filled once on construction.
+	template <typename R, bounded... Args>
+	class lookup_table
+	{
+	public:
+		using result_type = R;
+
+		template <typename F>
+		explicit lookup_table(F&& f)
+		{
+			values.reserve(details::table_size<Args...>);
+			for (std::size_t i = 0; i < details::table_size<Args...>; ++i)
+				values.push_back(std::apply(f, details::table_args<Args...>(i)));
+		}
+
+		[[nodiscard]] const R& operator()(const Args... args) const noexcept
+		{
+			return values[details::table_index(args...)];
+		}
+
+	private:
+		std::vector<R> values;
+	};
+
+	// Replaces a pure function of small Bounded arguments by a single table load.
+	// Captureless functions that are usable in constant expressions and return integers
+	// or Bounded values are tabulated at compile time with a narrowed result type;
+	// anything else is evaluated for every argument when the table is built.
+	template <bounded... Args, typename F>
+	[[nodiscard]] constexpr auto tabulate(F f)
+	{
+		static_assert(sizeof...(Args) > 0);
+		static_assert(details::fits_table<Args...>(), "Domain too wide to tabulate");
+
+		using R = std::remove_cvref_t<std::invoke_result_t<F&, Args...>>;
+		if constexpr (details::integer_like<R> && details::constant_invocable<F, Args...>)
+			return constant_lookup_table<F, Args...>{};
+		else
+			return lookup_table<R, Args...>{ f };
+	}
+}
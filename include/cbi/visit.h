@@ -0,0 +1,48 @@
+#pragma once
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include <utility>
+#include "cbi/bounded.h"
+
+namespace cbi
+{
+	namespace details
+	{
+		inline constexpr std::uintmax_t visit_max_cases = 256;
+
+		template <bounded B, std::size_t Offset>
+		using case_constant = std::integral_constant<typename B::underlying_type,
+			static_cast<typename B::underlying_type>(static_cast<std::uintmax_t>(B::lower_bound()) + Offset)>;
+
+		template <bounded B, typename Fn, std::size_t Offset>
+		constexpr decltype(auto) visit_case(Fn& fn)
+		{
+			return fn(case_constant<B, Offset>{});
+		}
+
+		template <bounded B, typename Fn, std::size_t... Offset>
+		constexpr decltype(auto) visit_table(const std::size_t offset, Fn& fn, std::index_sequence<Offset...>)
+		{
+			using result_type = decltype(visit_case<B, Fn, 0>(fn));
+			static_assert((std::is_same_v<result_type, decltype(visit_case<B, Fn, Offset>(fn))> && ...),
+				"Every case must return the same type");
+
+			constexpr std::array<result_type(*)(Fn&), sizeof...(Offset)> table{ &visit_case<B, Fn, Offset>... };
+			return table[offset](fn);
+		}
+	}
+
+	// Calls fn(std::integral_constant<underlying_type, v>{}) where v is the runtime value of b,
+	// through a jump table with one entry per value of B. Every entry is its own instantiation
+	// of fn, compiled with the value as a constant, and all of them must return the same type.
+	template <bounded B, typename Fn>
+	constexpr decltype(auto) visit(const B b, Fn&& fn)
+	{
+		static_assert(details::domain_at_most<B>(details::visit_max_cases), "Too many cases to visit");
+
+		return details::visit_table<B>(static_cast<std::size_t>(details::offset_from(b.get(), B::lower_bound())),
+			fn, std::make_index_sequence<static_cast<std::size_t>(details::domain_size<B>)>{});
+	}
+}
@@ -0,0 +1,185 @@
+#pragma once
+#include <algorithm>
+#include <cstdint>
+#include <optional>
+#include "cbi/bounded.h"
+
+namespace cbi
+{
+	namespace details
+	{
+#if defined(__SIZEOF_INT128__)
+		__extension__ typedef __int128 int128_t;
+		__extension__ typedef unsigned __int128 uint128_t;
+#endif
+
+		// Two's complement 128 bit value as a signed high and an unsigned low half.
+		struct wide_int
+		{
+			std::int64_t high;
+			std::uint64_t low;
+
+			[[nodiscard]] friend constexpr bool operator==(const wide_int&, const wide_int&) noexcept = default;
+
+			[[nodiscard]] friend constexpr bool operator<(const wide_int fst, const wide_int sec) noexcept
+			{
+				return fst.high != sec.high ? fst.high < sec.high : fst.low < sec.low;
+			}
+		};
+
+		[[nodiscard]] constexpr wide_int negate(const wide_int value) noexcept
+		{
+			const std::uint64_t low = 0 - value.low;
+			return { static_cast<std::int64_t>(~static_cast<std::uint64_t>(value.high) + (low == 0 ? 1 : 0)), low };
+		}
+
+		// High half of the unsigned 128 bit product.
+		[[nodiscard]] constexpr std::uint64_t mul_high(const std::uint64_t fst, const std::uint64_t sec) noexcept
+		{
+#if defined(__SIZEOF_INT128__)
+			return static_cast<std::uint64_t>((static_cast<uint128_t>(fst) * sec) >> 64);
+#else
+			// schoolbook multiply in 32 bit halves
+			const std::uint64_t a_lo = fst & 0xFFFFFFFF, a_hi = fst >> 32;
+			const std::uint64_t b_lo = sec & 0xFFFFFFFF, b_hi = sec >> 32;
+			const std::uint64_t ll = a_lo * b_lo, lh = a_lo * b_hi, hl = a_hi * b_lo, hh = a_hi * b_hi;
+			const std::uint64_t mid = (ll >> 32) + (lh & 0xFFFFFFFF) + (hl & 0xFFFFFFFF);
+			return hh + (lh >> 32) + (hl >> 32) + (mid >> 32);
+#endif
+		}
+
+		[[nodiscard]] constexpr wide_int wide_mul(const std::intmax_t fst, const std::intmax_t sec) noexcept
+		{
+#if defined(__SIZEOF_INT128__)
+			const int128_t product = static_cast<int128_t>(fst) * sec;
+			return { static_cast<std::int64_t>(product >> 64), static_cast<std::uint64_t>(product) };
+#else
+			const std::uint64_t a = magnitude_of(fst), b = magnitude_of(sec);
+			const wide_int product{ static_cast<std::int64_t>(mul_high(a, b)), a * b };
+			return (fst < 0) != (sec < 0) ? negate(product) : product;
+#endif
+		}
+
+		// Arithmetic shift, rounds toward negative infinity.
+		[[nodiscard]] constexpr wide_int wide_shr(const wide_int value, const unsigned shift) noexcept
+		{
+			if (shift == 0)
+				return value;
+			if (shift < 64)
+				return { value.high >> shift, (value.low >> shift) | (static_cast<std::uint64_t>(value.high) << (64 - shift)) };
+			return { value.high >> 63, static_cast<std::uint64_t>(value.high >> (shift - 64)) };
+		}
+
+		// Division truncating toward zero like the built in operator.
+		[[nodiscard]] constexpr wide_int wide_div(const wide_int value, const std::intmax_t divisor) noexcept
+		{
+#if defined(__SIZEOF_INT128__)
+			const int128_t quotient = ((static_cast<int128_t>(value.high) << 64) | value.low) / divisor;
+			return { static_cast<std::int64_t>(quotient >> 64), static_cast<std::uint64_t>(quotient) };
+#else
+			// long division of the magnitudes, one quotient bit per step
+			const bool negative = (value.high < 0) != (divisor < 0);
+			const wide_int dividend = value.high < 0 ? negate(value) : value;
+			const std::uint64_t magnitude = magnitude_of(divisor);
+			std::uint64_t high = static_cast<std::uint64_t>(dividend.high), low = dividend.low, remainder = 0;
+			for (int i = 0; i < 128; ++i)
+			{
+				const bool carry = remainder >> 63;
+				remainder = (remainder << 1) | (high >> 63);
+				high = (high << 1) | (low >> 63);
+				low <<= 1;
+				if (carry || remainder >= magnitude)
+				{
+					remainder -= magnitude;
+					low |= 1;
+				}
+			}
+			const wide_int quotient{ static_cast<std::int64_t>(high), low };
+			return negative ? negate(quotient) : quotient;
+#endif
+		}
+
+		[[nodiscard]] constexpr std::optional<std::intmax_t> narrow(const wide_int value) noexcept
+		{
+			const auto low = static_cast<std::intmax_t>(value.low);
+			if (value.high != (low < 0 ? -1 : 0))
+				return std::nullopt;
+			return low;
+		}
+
+		template <bounded Fst, bounded Sec>
+		struct wide_bounds
+		{
+			static constexpr wide_int b0 = wide_mul(Fst::upper_bound(), Sec::upper_bound());
+			static constexpr wide_int b1 = wide_mul(Fst::upper_bound(), Sec::lower_bound());
+			static constexpr wide_int b2 = wide_mul(Fst::lower_bound(), Sec::upper_bound());
+			static constexpr wide_int b3 = wide_mul(Fst::lower_bound(), Sec::lower_bound());
+
+			static constexpr wide_int lower_bound = std::min({ b0, b1, b2, b3 });
+			static constexpr wide_int upper_bound = std::max({ b0, b1, b2, b3 });
+		};
+	}
+
+	// Full product of two Bounded values of up to 64 bits, in the halves of a 128 bit
+	// two's complement integer. Scale it back down with shift or div.
+	template <bounded Fst, bounded Sec>
+	class wide_product
+	{
+		using bounds = details::wide_bounds<Fst, Sec>;
+
+	public:
+		constexpr wide_product(const Fst fst, const Sec sec) noexcept : value(details::wide_mul(fst.get(), sec.get())) {}
+
+		[[nodiscard]] constexpr std::int64_t high() const noexcept { return value.high; }
+		[[nodiscard]] constexpr std::uint64_t low() const noexcept { return value.low; }
+
+		// The product divided by 2^N, rounded toward negative infinity.
+		template <unsigned N>
+		[[nodiscard]] constexpr auto shift() const noexcept
+		{
+			static_assert(N < 128, "Shift count out of range");
+			constexpr auto lower_bound = details::narrow(details::wide_shr(bounds::lower_bound, N));
+			constexpr auto upper_bound = details::narrow(details::wide_shr(bounds::upper_bound, N));
+			static_assert(lower_bound.has_value() && upper_bound.has_value(), "Possible overflow detected!");
+
+			using ResType = details::least_bounded_t<*lower_bound, *upper_bound>;
+			return ResType{ static_cast<typename ResType::underlying_type>(*details::narrow(details::wide_shr(value, N))) };
+		}
+
+		// The product divided by D, truncated toward zero.
+		template <std::intmax_t D>
+		[[nodiscard]] constexpr auto div() const noexcept
+		{
+			static_assert(D != 0, "Division by zero is possible");
+			constexpr auto q0 = details::narrow(details::wide_div(bounds::lower_bound, D));
+			constexpr auto q1 = details::narrow(details::wide_div(bounds::upper_bound, D));
+			static_assert(q0.has_value() && q1.has_value(), "Possible overflow detected!");
+
+			using ResType = details::least_bounded_t<std::min(*q0, *q1), std::max(*q0, *q1)>;
+			return ResType{ static_cast<typename ResType::underlying_type>(*details::narrow(details::wide_div(value, D))) };
+		}
+
+	private:
+		details::wide_int value;
+	};
+
+	template <bounded Fst, bounded Sec>
+	[[nodiscard]] constexpr wide_product<Fst, Sec> mul_wide(const Fst fst, const Sec sec) noexcept
+	{
+		return { fst, sec };
+	}
+
+	// fst * sec / 2^N without overflowing in the product, the result bounds follow from the operands.
+	template <unsigned N, bounded Fst, bounded Sec>
+	[[nodiscard]] constexpr auto mul_shift(const Fst fst, const Sec sec) noexcept
+	{
+		return mul_wide(fst, sec).template shift<N>();
+	}
+
+	// fst * sec / D without overflowing in the product, e.g. price * quantity / scale.
+	template <std::intmax_t D, bounded Fst, bounded Sec>
+	[[nodiscard]] constexpr auto mul_div(const Fst fst, const Sec sec) noexcept
+	{
+		return mul_wide(fst, sec).template div<D>();
+	}
+}
@@ -0,0 +1,143 @@
+#pragma once
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <optional>
+#include <span>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include "cbi/bounded.h"
+
+namespace cbi
+{
+	namespace details
+	{
+		[[nodiscard]] constexpr std::uint64_t swap_bytes(const std::uint64_t value) noexcept
+		{
+			std::uint64_t res = 0;
+			for (int i = 0; i < 8; ++i)
+				res |= ((value >> (i * 8)) & 0xff) << ((7 - i) * 8);
+			return res;
+		}
+
+		// Loads Bytes bytes starting at data as an unsigned integer in the given byte order.
+		template <std::size_t Bytes, std::endian Order>
+		[[nodiscard]] inline std::uint64_t load_bytes(const std::byte* data) noexcept
+		{
+			static_assert(Bytes > 0 && Bytes <= 8);
+			static_assert(std::endian::native == std::endian::little || std::endian::native == std::endian::big);
+
+			std::uint64_t word = 0;
+			std::memcpy(&word, data, Bytes);
+			if constexpr (Order != std::endian::native)
+				word = swap_bytes(word);
+			// a big endian value now starts at the most significant byte of the word
+			if constexpr (Order == std::endian::big && Bytes < 8)
+				word >>= (8 - Bytes) * 8;
+			return word;
+		}
+	}
+
+	// A field of a wire record: Bits bits starting BitOffset bits into the record, holding
+	// the value itself, two's complement when B allows negative values. Little endian records
+	// count bits from the least significant bit of the first byte, big endian ones from the
+	// most significant bit, as network protocols do.
+	template <bounded B, std::size_t BitOffset, std::size_t Bits = sizeof(typename B::underlying_type) * 8,
+		std::endian Order = std::endian::little>
+	struct wire_field
+	{
+		static_assert(Bits > 0 && (BitOffset % 8) + Bits <= 64, "Field must fit into one 64 bit load");
+
+		using value_type = B;
+		static constexpr bool is_signed = B::lower_bound() < 0;
+		static constexpr std::size_t first_byte = BitOffset / 8;
+		static constexpr std::size_t byte_count = ((BitOffset % 8) + Bits + 7) / 8;
+		static constexpr std::size_t end_byte = first_byte + byte_count;
+
+		// unsigned fields decode to std::uint64_t, 64 bit ones may exceed intmax_t
+		using raw_type = std::conditional_t<is_signed, std::intmax_t, std::uint64_t>;
+		static constexpr raw_type raw_min = is_signed ? static_cast<raw_type>(-static_cast<std::intmax_t>(details::low_mask(Bits - 1)) - 1) : 0;
+		static constexpr raw_type raw_max = static_cast<raw_type>(details::low_mask(is_signed ? Bits - 1 : Bits));
+
+		// true when some bit patterns decode to values outside of B
+		static constexpr bool needs_validation = std::cmp_less(raw_min, B::lower_bound()) || std::cmp_greater(raw_max, B::upper_bound());
+
+		[[nodiscard]] static raw_type decode(const std::byte* record) noexcept
+		{
+			const std::uint64_t word = details::load_bytes<byte_count, Order>(record + first_byte);
+			constexpr std::size_t shift = Order == std::endian::little
+				? BitOffset % 8
+				: byte_count * 8 - (BitOffset % 8) - Bits;
+			const std::uint64_t bits = (word >> shift) & details::low_mask(Bits);
+
+			if constexpr (is_signed && Bits < 64)
+			{
+				constexpr std::uint64_t sign = std::uint64_t{ 1 } << (Bits - 1);
+				return static_cast<std::intmax_t>(bits ^ sign) - static_cast<std::intmax_t>(sign);
+			}
+			else
+			{
+				return static_cast<raw_type>(bits);
+			}
+		}
+
+		[[nodiscard]] static bool valid(const std::byte* record) noexcept
+		{
+			if constexpr (!needs_validation)
+			{
+				return true;
+			}
+			else
+			{
+				const raw_type value = decode(record);
+				return std::cmp_greater_equal(value, B::lower_bound()) & std::cmp_less_equal(value, B::upper_bound());
+			}
+		}
+
+		[[nodiscard]] static B get(const std::byte* record) noexcept
+		{
+			return B{ static_cast<typename B::underlying_type>(decode(record)) };
+		}
+	};
+
+	// Typed read-only view of one wire record. Fields whose bit width already proves their
+	// range are never checked; the others are validated together, once, by make().
+	template <typename... Fields>
+	class wire_view
+	{
+	public:
+		static constexpr std::size_t record_size = std::max({ std::size_t{ 0 }, Fields::end_byte... });
+		static constexpr bool needs_validation = (Fields::needs_validation || ...);
+		template <std::size_t I> using field_type = typename std::tuple_element_t<I, std::tuple<Fields...>>::value_type;
+
+		// Returns std::nullopt for a short buffer or when any field is out of bounds.
+		[[nodiscard]] static std::optional<wire_view> make(const std::span<const std::byte> bytes) noexcept
+		{
+			if (bytes.size() < record_size)
+				return std::nullopt;
+			// no short circuit, all checks compile into one straight line of compares
+			if (!(Fields::valid(bytes.data()) & ... & true))
+				return std::nullopt;
+			return std::optional{ wire_view{ bytes.data() } };
+		}
+
+		template <std::size_t I>
+		[[nodiscard]] field_type<I> get() const noexcept
+		{
+			return std::tuple_element_t<I, std::tuple<Fields...>>::get(data);
+		}
+
+		[[nodiscard]] std::span<const std::byte, record_size> bytes() const noexcept
+		{
+			return std::span<const std::byte, record_size>{ data, record_size };
+		}
+
+	private:
+		explicit wire_view(const std::byte* data) noexcept : data(data) {}
+
+		const std::byte* data;
+	};
+}
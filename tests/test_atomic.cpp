@@ -0,0 +1,110 @@
+#include <thread>
+#include <vector>
+#include "catch.hpp"
+#include "cbi/cbi.h"
+
+TEST_CASE("atomic storage type")
+{
+	static_assert(std::same_as<cbi::atomic<cbi::Bounded<int32_t, 0, 255>>::storage_type, uint8_t>);
+	static_assert(std::same_as<cbi::atomic<cbi::Bounded<int64_t, -1000, 1000>>::storage_type, uint16_t>);
+	static_assert(std::same_as<cbi::atomic<cbi::Bounded<int32_t>>::storage_type, uint32_t>);
+	static_assert(std::same_as<cbi::atomic<cbi::Bounded<int64_t>>::storage_type, uint64_t>);
+	static_assert(sizeof(cbi::atomic<cbi::Bounded<int32_t, 1000, 1100>>) == 1);
+
+	static_assert(cbi::atomic<cbi::Bounded<int32_t, 0, 15>, cbi::overflow_policy::wrap>::native_wrap);
+	static_assert(!cbi::atomic<cbi::Bounded<int32_t, 0, 14>, cbi::overflow_policy::wrap>::native_wrap);
+	static_assert(!cbi::atomic<cbi::Bounded<int32_t, 0, 15>>::native_wrap);
+}
+
+TEST_CASE("atomic saturate")
+{
+	using num_t = cbi::Bounded<int32_t, -10, 10>;
+	using delta_t = cbi::Bounded<int32_t, -100, 100>;
+	cbi::atomic<num_t> counter{ num_t{ 5 } };
+
+	REQUIRE(counter.fetch_add(delta_t{ 3 }).get() == 5);
+	REQUIRE(counter.load().get() == 8);
+	REQUIRE(counter.fetch_add(delta_t{ 50 }).get() == 8);
+	REQUIRE(counter.load().get() == 10);
+	REQUIRE(counter.fetch_sub(delta_t{ 100 }).get() == 10);
+	REQUIRE(counter.load().get() == -10);
+	REQUIRE(counter.fetch_add(delta_t{ -1 }).get() == -10);
+	REQUIRE(counter.load().get() == -10);
+}
+
+TEST_CASE("atomic reject")
+{
+	using num_t = cbi::Bounded<int16_t, 0, 100>;
+	using delta_t = cbi::Bounded<int8_t>;
+	cbi::atomic<num_t, cbi::overflow_policy::reject> quota{ num_t{ 95 } };
+
+	REQUIRE(quota.fetch_add(delta_t{ 5 })->get() == 95);
+	REQUIRE_FALSE(quota.fetch_add(delta_t{ 1 }).has_value());
+	REQUIRE(quota.load().get() == 100);
+	REQUIRE_FALSE(quota.fetch_sub(delta_t{ 101 }).has_value());
+	REQUIRE(quota.fetch_sub(delta_t{ 100 })->get() == 100);
+	REQUIRE(quota.load().get() == 0);
+}
+
+TEST_CASE("atomic wrap")
+{
+	using num_t = cbi::Bounded<int32_t, 10, 14>;
+	using delta_t = cbi::Bounded<int64_t>;
+	cbi::atomic<num_t, cbi::overflow_policy::wrap> ring{ num_t{ 13 } };
+
+	REQUIRE(ring.fetch_add(delta_t{ 3 }).get() == 13);
+	REQUIRE(ring.load().get() == 11);
+	ring.fetch_sub(delta_t{ 2 });
+	REQUIRE(ring.load().get() == 14);
+	ring.fetch_add(delta_t{ std::numeric_limits<int64_t>::min() });
+	// 2^63 % 5 == 3, so this steps back by 3 from offset 4
+	REQUIRE(ring.load().get() == 11);
+}
+
+TEST_CASE("atomic native wrap")
+{
+	using num_t = cbi::Bounded<int8_t, -8, 7>;
+	using delta_t = cbi::Bounded<int32_t, -100, 100>;
+	cbi::atomic<num_t, cbi::overflow_policy::wrap> ring{ num_t{ 7 } };
+
+	REQUIRE(ring.fetch_add(delta_t{ 1 }).get() == 7);
+	REQUIRE(ring.load().get() == -8);
+	ring.fetch_sub(delta_t{ 17 });
+	REQUIRE(ring.load().get() == 7);
+
+	num_t expected{ 6 };
+	REQUIRE_FALSE(ring.compare_exchange_strong(expected, num_t{ 0 }));
+	REQUIRE(expected.get() == 7);
+	REQUIRE(ring.compare_exchange_strong(expected, num_t{ 0 }));
+	REQUIRE(ring.exchange(num_t{ 3 }).get() == 0);
+	REQUIRE(ring.load().get() == 3);
+}
+
+TEST_CASE("atomic concurrent updates stay in bounds")
+{
+	using num_t = cbi::Bounded<int32_t, 0, 1000>;
+	using delta_t = cbi::Bounded<int8_t, 1, 1>;
+	cbi::atomic<num_t> saturating{ num_t{ 0 } };
+	cbi::atomic<num_t, cbi::overflow_policy::reject> rejecting{ num_t{ 0 } };
+	std::atomic<int> accepted = 0;
+
+	{
+		std::vector<std::jthread> threads;
+		for (int t = 0; t < 4; ++t)
+		{
+			threads.emplace_back([&]
+			{
+				for (int i = 0; i < 600; ++i)
+				{
+					saturating.fetch_add(delta_t{ 1 });
+					if (rejecting.fetch_add(delta_t{ 1 }))
+						++accepted;
+				}
+			});
+		}
+	}
+
+	REQUIRE(saturating.load().get() == 1000);
+	REQUIRE(rejecting.load().get() == 1000);
+	REQUIRE(accepted == 1000);
+}
@@ -214,3 +214,295 @@ TEST_CASE("div very large bounds inverted")
 	static_assert(std::same_as<expected_t, decltype(res)>);
 	REQUIRE(res.get() == 1);
 }
+
+TEST_CASE("compare overlapping bounds")
+{
+	constexpr cbi::Bounded<int64_t, 0, 100> fst{ 40 };
+	constexpr cbi::Bounded<int8_t, 50, 120> sec{ 50 };
+
+	static_assert(std::same_as<cbi::details::compare_type<decltype(fst), decltype(sec)>, int8_t>);
+	static_assert(std::same_as<decltype(fst < sec), bool>);
+	REQUIRE(fst < sec);
+	REQUIRE(fst <= sec);
+	REQUIRE_FALSE(fst > sec);
+	REQUIRE_FALSE(fst >= sec);
+	REQUIRE_FALSE(fst == sec);
+	REQUIRE(fst != sec);
+	REQUIRE((fst <=> sec) == std::strong_ordering::less);
+	REQUIRE(cbi::Bounded<int32_t, 0, 60>{ 50 } == sec);
+}
+
+TEST_CASE("compare decided by the bounds")
+{
+	constexpr cbi::Bounded<int32_t, 0, 9> digit{ 3 };
+	constexpr cbi::Bounded<int64_t, 10, 99> two_digits{ 42 };
+
+	static_assert(std::same_as<decltype(digit < two_digits), std::true_type>);
+	static_assert(std::same_as<decltype(digit > two_digits), std::false_type>);
+	static_assert(std::same_as<decltype(digit == two_digits), std::false_type>);
+	static_assert(std::same_as<decltype(digit != two_digits), std::true_type>);
+	static_assert(std::same_as<decltype(digit <= cbi::constant<9>), std::true_type>);
+	static_assert(std::same_as<decltype(digit >= cbi::constant<0>), std::true_type>);
+	static_assert(std::same_as<decltype(digit < cbi::constant<9>), bool>);
+	static_assert(std::same_as<decltype(cbi::constant<5> == cbi::constant<5>), std::true_type>);
+	static_assert((two_digits <=> digit) == std::strong_ordering::greater);
+
+	if constexpr (decltype(two_digits >= cbi::constant<10>)::value)
+		SUCCEED();
+	else
+		FAIL();
+}
+
+TEST_CASE("compare against integers")
+{
+	constexpr cbi::Bounded<int16_t, -5, 500> value{ 300 };
+	static_assert(value == 300);
+	static_assert(300 == value);
+	static_assert(value != 301);
+	static_assert(value < 301);
+	static_assert(299 < value);
+	static_assert(value > -1);
+	static_assert(value <= 300u);
+	static_assert(cbi::Bounded<int8_t, -5, 5>{ -1 } < 0u);
+	static_assert(std::same_as<decltype(cbi::constant<300>), const cbi::Bounded<int16_t, 300, 300>>);
+}
+
+namespace
+{
+	// Applies op to every pair of values and checks the result stays inside its bounds.
+	template <typename Fst, typename Sec, typename Op, typename RawOp>
+	void check_every_pair(Op op, RawOp raw_op)
+	{
+		for (std::intmax_t a = Fst::lower_bound(); a <= Fst::upper_bound(); ++a)
+		{
+			for (std::intmax_t b = Sec::lower_bound(); b <= Sec::upper_bound(); ++b)
+			{
+				const auto res = op(Fst{ static_cast<typename Fst::underlying_type>(a) }, Sec{ static_cast<typename Sec::underlying_type>(b) });
+				REQUIRE(res.get() == raw_op(a, b));
+				REQUIRE(res.lower_bound() <= res.get());
+				REQUIRE(res.get() <= res.upper_bound());
+			}
+		}
+	}
+}
+
+TEST_CASE("bitwise bounds")
+{
+	using any_t = cbi::Bounded<int64_t>;
+	static_assert(std::same_as<decltype(cbi::Bounded<int64_t, 0, 1ll << 40>{ 0 } & cbi::constant<0xFF>), cbi::Bounded<int64_t, 0, 255>>);
+	static_assert(std::same_as<decltype(any_t{ 0 } & cbi::constant<0xFF>), cbi::Bounded<int64_t, 0, 255>>);
+	static_assert(std::same_as<decltype(cbi::Bounded<int8_t, 0, 5>{ 0 } | cbi::Bounded<int8_t, 0, 9>{ 0 }), cbi::Bounded<int8_t, 0, 15>>);
+	static_assert(std::same_as<decltype(cbi::Bounded<int8_t, 0, 5>{ 0 } ^ cbi::Bounded<int8_t, -3, -1>{ -1 }), cbi::Bounded<int8_t, -8, -1>>);
+	REQUIRE((any_t{ 0x1234 } & cbi::constant<0xFF>).get() == 0x34);
+
+	using small_t = cbi::Bounded<int8_t, -6, 5>;
+	using other_t = cbi::Bounded<int8_t, -3, 9>;
+	using negative_t = cbi::Bounded<int8_t, -20, -4>;
+	const auto and_op = [](auto a, auto b) { return a & b; };
+	const auto or_op = [](auto a, auto b) { return a | b; };
+	const auto xor_op = [](auto a, auto b) { return a ^ b; };
+	check_every_pair<small_t, other_t>(and_op, and_op);
+	check_every_pair<small_t, other_t>(or_op, or_op);
+	check_every_pair<small_t, other_t>(xor_op, xor_op);
+	check_every_pair<negative_t, other_t>(and_op, and_op);
+	check_every_pair<negative_t, other_t>(or_op, or_op);
+	check_every_pair<negative_t, negative_t>(xor_op, xor_op);
+}
+
+TEST_CASE("shift bounds")
+{
+	using count_t = cbi::Bounded<int8_t, 0, 3>;
+	static_assert(std::same_as<decltype(cbi::Bounded<int8_t, -3, 100>{ 0 } << count_t{ 0 }), cbi::Bounded<int16_t, -24, 800>>);
+	static_assert(std::same_as<decltype(cbi::Bounded<int32_t, -3, 100>{ 0 } >> count_t{ 0 }), cbi::Bounded<int32_t, -3, 100>>);
+	static_assert(std::same_as<decltype(cbi::Bounded<int32_t, 64, 100>{ 64 } >> cbi::constant<4>), cbi::Bounded<int32_t, 4, 6>>);
+	static_assert(std::same_as<decltype(cbi::constant<1> << cbi::Bounded<int8_t, 0, 62>{ 0 }), cbi::Bounded<int64_t, 1, 1ll << 62>>);
+	REQUIRE((cbi::constant<1> << cbi::Bounded<int8_t, 0, 62>{ 62 }).get() == 1ll << 62);
+
+	using value_t = cbi::Bounded<int16_t, -40, 33>;
+	check_every_pair<value_t, count_t>([](auto a, auto b) { return a << b; }, [](std::intmax_t a, std::intmax_t b) { return a * (1 << b); });
+	check_every_pair<value_t, count_t>([](auto a, auto b) { return a >> b; }, [](std::intmax_t a, std::intmax_t b) { return a >> b; });
+}
+
+TEST_CASE("remainder bounds")
+{
+	static_assert(std::same_as<decltype(cbi::Bounded<int32_t, 0, 1000>{ 0 } % cbi::constant<16>), cbi::Bounded<int32_t, 0, 15>>);
+	static_assert(std::same_as<decltype(cbi::Bounded<int32_t, -1000, 5>{ 0 } % cbi::constant<16>), cbi::Bounded<int32_t, -15, 5>>);
+	static_assert(std::same_as<decltype(cbi::Bounded<int32_t, 3, 7>{ 3 } % cbi::Bounded<int8_t, 8, 12>{ 8 }), cbi::Bounded<int32_t, 3, 7>>);
+
+	using divisor_t = cbi::Bounded<int8_t, -7, -2>;
+	const auto mod_op = [](auto a, auto b) { return a % b; };
+	check_every_pair<cbi::Bounded<int16_t, -30, 30>, divisor_t>(mod_op, mod_op);
+	check_every_pair<cbi::Bounded<int8_t, -128, 127>, cbi::Bounded<int8_t, -1, -1>>(mod_op, mod_op);
+}
+
+TEST_CASE("compound assignment")
+{
+	cbi::Bounded<int32_t, -1000, 1000> total{ 10 };
+	total += cbi::Bounded<int8_t, -5, 5>{ 5 };
+	REQUIRE(total.get() == 15);
+	total -= cbi::constant<20>;
+	REQUIRE(total.get() == -5);
+	total *= cbi::Bounded<int8_t, -3, 3>{ -3 };
+	REQUIRE(total.get() == 15);
+
+	cbi::Bounded<int8_t, 0, 9> digit{ 0 };
+	for (int i = 0; i < 9; ++i)
+		++digit;
+	REQUIRE(digit.get() == 9);
+	REQUIRE((digit--).get() == 9);
+	REQUIRE((--digit).get() == 7);
+
+#ifdef NDEBUG
+	// without the asserts an out of range result saturates instead of breaking the bounds
+	digit += cbi::Bounded<int8_t, 0, 100>{ 100 };
+	REQUIRE(digit.get() == 9);
+	++digit;
+	REQUIRE(digit.get() == 9);
+	digit *= cbi::constant<-1>;
+	REQUIRE(digit.get() == 0);
+#endif
+}
+
+TEST_CASE("policy updates")
+{
+	using percent_t = cbi::Bounded<int8_t, 0, 100>;
+
+	percent_t saturated{ 90 };
+	REQUIRE_FALSE(cbi::add_assign<cbi::overflow_policy::saturate>(saturated, cbi::constant<20>));
+	REQUIRE(saturated.get() == 100);
+	REQUIRE_FALSE(cbi::mul_assign<cbi::overflow_policy::saturate>(saturated, cbi::constant<-1>));
+	REQUIRE(saturated.get() == 0);
+	REQUIRE(cbi::increment<cbi::overflow_policy::saturate>(saturated));
+	REQUIRE(saturated.get() == 1);
+
+	percent_t rejected{ 95 };
+	REQUIRE_FALSE(cbi::add_assign<cbi::overflow_policy::reject>(rejected, cbi::constant<6>));
+	REQUIRE(rejected.get() == 95);
+	REQUIRE(cbi::sub_assign<cbi::overflow_policy::reject>(rejected, cbi::constant<95>));
+	REQUIRE_FALSE(cbi::decrement<cbi::overflow_policy::reject>(rejected));
+	REQUIRE(rejected.get() == 0);
+
+	cbi::Bounded<int16_t, -10, 10> wrapped{ 8 };
+	REQUIRE_FALSE(cbi::add_assign<cbi::overflow_policy::wrap>(wrapped, cbi::constant<5>));
+	REQUIRE(wrapped.get() == -8);
+	REQUIRE_FALSE(cbi::sub_assign<cbi::overflow_policy::wrap>(wrapped, cbi::constant<50>));
+	REQUIRE(wrapped.get() == 5);
+
+	// proven updates never fail
+	cbi::Bounded<int16_t, -300, 300> wide{ 0 };
+	REQUIRE(cbi::add_assign<cbi::overflow_policy::reject>(wide, cbi::Bounded<int8_t, -128, 127>{ -128 }));
+	REQUIRE(wide.get() == -128);
+
+	// sums that may not fit intmax_t step the offset
+	using any_t = cbi::Bounded<int64_t>;
+	any_t big{ std::numeric_limits<int64_t>::max() - 1 };
+	REQUIRE_FALSE(cbi::add_assign<cbi::overflow_policy::saturate>(big, any_t{ 5 }));
+	REQUIRE(big.get() == std::numeric_limits<int64_t>::max());
+	REQUIRE_FALSE(cbi::add_assign<cbi::overflow_policy::wrap>(big, any_t{ 1 }));
+	REQUIRE(big.get() == std::numeric_limits<int64_t>::min());
+	REQUIRE(cbi::sub_assign<cbi::overflow_policy::reject>(big, any_t{ -7 }));
+	REQUIRE(big.get() == std::numeric_limits<int64_t>::min() + 7);
+}
+
+TEST_CASE("policy updates on uint64 destinations")
+{
+	using count_t = cbi::Bounded<uint64_t, 0, 1000>;
+	using factor_t = cbi::Bounded<int8_t, -3, 3>;
+
+	count_t saturated{ 0 };
+	REQUIRE_FALSE(cbi::decrement<cbi::overflow_policy::saturate>(saturated));
+	REQUIRE(saturated.get() == 0);
+	saturated = count_t{ 2 };
+	REQUIRE_FALSE(cbi::sub_assign<cbi::overflow_policy::saturate>(saturated, cbi::constant<5>));
+	REQUIRE(saturated.get() == 0);
+	saturated = count_t{ 7 };
+	REQUIRE_FALSE(cbi::mul_assign<cbi::overflow_policy::saturate>(saturated, factor_t{ -1 }));
+	REQUIRE(saturated.get() == 0);
+	saturated = count_t{ 500 };
+	REQUIRE_FALSE(cbi::mul_assign<cbi::overflow_policy::saturate>(saturated, factor_t{ 3 }));
+	REQUIRE(saturated.get() == 1000);
+
+	count_t rejected{ 0 };
+	REQUIRE_FALSE(cbi::decrement<cbi::overflow_policy::reject>(rejected));
+	REQUIRE(rejected.get() == 0);
+	rejected = count_t{ 2 };
+	REQUIRE_FALSE(cbi::sub_assign<cbi::overflow_policy::reject>(rejected, cbi::constant<5>));
+	REQUIRE(rejected.get() == 2);
+	REQUIRE_FALSE(cbi::mul_assign<cbi::overflow_policy::reject>(rejected, factor_t{ -2 }));
+	REQUIRE(rejected.get() == 2);
+	REQUIRE(cbi::mul_assign<cbi::overflow_policy::reject>(rejected, factor_t{ 3 }));
+	REQUIRE(rejected.get() == 6);
+
+	// modulo 1001
+	count_t wrapped{ 0 };
+	REQUIRE_FALSE(cbi::decrement<cbi::overflow_policy::wrap>(wrapped));
+	REQUIRE(wrapped.get() == 1000);
+	wrapped = count_t{ 2 };
+	REQUIRE_FALSE(cbi::sub_assign<cbi::overflow_policy::wrap>(wrapped, cbi::constant<5>));
+	REQUIRE(wrapped.get() == 998);
+	wrapped = count_t{ 7 };
+	REQUIRE_FALSE(cbi::mul_assign<cbi::overflow_policy::wrap>(wrapped, factor_t{ -1 }));
+	REQUIRE(wrapped.get() == 994);
+	wrapped = count_t{ 500 };
+	REQUIRE_FALSE(cbi::mul_assign<cbi::overflow_policy::wrap>(wrapped, factor_t{ 3 }));
+	REQUIRE(wrapped.get() == 499);
+}
+
+TEST_CASE("unsigned bounds")
+{
+	using pixel_t = cbi::Bounded<uint8_t, 0, 255>;
+	static_assert(cbi::unsigned_bounded<pixel_t>);
+	static_assert(sizeof(pixel_t) == 1);
+	static_assert(cbi::Bounded<uint64_t>::upper_bound() == static_cast<uint64_t>(std::numeric_limits<int64_t>::max()));
+	static_assert(std::same_as<decltype(cbi::constant<200>), const cbi::Bounded<uint8_t, 200, 200>>);
+
+	const pixel_t bright{ 250 };
+	const pixel_t dark{ 10 };
+
+	const auto sum = bright + dark;
+	static_assert(std::same_as<decltype(sum), const cbi::Bounded<uint16_t, 0, 510>>);
+	REQUIRE(sum.get() == 260);
+
+	const auto difference = dark - bright;
+	static_assert(std::same_as<decltype(difference), const cbi::Bounded<int16_t, -255, 255>>);
+	REQUIRE(difference.get() == -240);
+
+	const auto average = sum / cbi::constant<2>;
+	static_assert(std::same_as<decltype(average), const cbi::Bounded<uint16_t, 0, 255>>);
+	REQUIRE(average.get() == 130);
+
+	REQUIRE((bright & cbi::constant<0x0F>).get() == 10);
+	REQUIRE((bright >> cbi::constant<4>).get() == 15);
+	REQUIRE(dark < bright);
+	REQUIRE(cbi::max(dark, bright).get() == 250);
+}
+
+TEST_CASE("mixed sign arithmetic")
+{
+	using wide_unsigned_t = cbi::Bounded<uint32_t, 0, 4'000'000'000>;
+	using small_signed_t = cbi::Bounded<int32_t, -10, 10>;
+
+	const auto shifted = wide_unsigned_t{ 3 } + small_signed_t{ -7 };
+	static_assert(std::same_as<decltype(shifted), const cbi::Bounded<int64_t, -10, 4'000'000'010>>);
+	REQUIRE(shifted.get() == -4);
+
+	const auto product = wide_unsigned_t{ 5 } * small_signed_t{ -2 };
+	REQUIRE(product.get() == -10);
+
+	const auto quotient = small_signed_t{ -9 } / cbi::Bounded<uint32_t, 2, 4>{ 2 };
+	static_assert(std::same_as<decltype(quotient), const cbi::Bounded<int32_t, -5, 5>>);
+	REQUIRE(quotient.get() == -4);
+
+	const auto differences = cbi::Bounded<uint32_t, 0, 10>{ 3 } - cbi::Bounded<uint32_t, 0, 10>{ 5 };
+	REQUIRE(differences.get() == -2);
+
+	REQUIRE((small_signed_t{ -1 } | cbi::Bounded<uint32_t, 0, 3>{ 2 }).get() == -1);
+	REQUIRE(small_signed_t{ -1 } < wide_unsigned_t{ 0 });
+	REQUIRE((small_signed_t{ 9 } <=> wide_unsigned_t{ 9 }) == std::strong_ordering::equal);
+
+	cbi::Bounded<uint16_t, 0, 1000> level{ 5 };
+	REQUIRE_FALSE(cbi::add_assign<cbi::overflow_policy::saturate>(level, small_signed_t{ -10 }));
+	REQUIRE(level.get() == 0);
+	level += cbi::Bounded<int8_t, 0, 7>{ 7 };
+	REQUIRE(level.get() == 7);
+}
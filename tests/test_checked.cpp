@@ -0,0 +1,57 @@
+#include <limits>
+#include <optional>
+#include "catch.hpp"
+#include "cbi/cbi.h"
+
+namespace
+{
+	using any_t = cbi::Bounded<int64_t>;
+	constexpr auto int64_min = std::numeric_limits<int64_t>::min();
+	constexpr auto int64_max = std::numeric_limits<int64_t>::max();
+}
+
+TEST_CASE("checked arithmetic is the operator when the bounds prove it")
+{
+	const auto sum = cbi::checked_add(cbi::Bounded<int32_t, 0, 100>{ 60 }, cbi::Bounded<int32_t, -5, 5>{ 5 });
+	static_assert(std::same_as<decltype(sum), const cbi::Bounded<int32_t, -5, 105>>);
+	REQUIRE(sum.get() == 65);
+
+	const auto product = cbi::checked_mul(cbi::Bounded<int32_t>{ -70000 }, cbi::Bounded<int32_t>{ 70000 });
+	static_assert(std::same_as<decltype(product), const cbi::Bounded<int64_t, -4611686016279904256ll, 4611686018427387904ll>>);
+	REQUIRE(product.get() == -4900000000ll);
+}
+
+TEST_CASE("checked add and sub report overflow")
+{
+	const auto sum = cbi::checked_add(any_t{ int64_max - 10 }, cbi::Bounded<int64_t, 0, int64_max>{ 10 });
+	static_assert(std::same_as<decltype(sum), const std::optional<any_t>>);
+	REQUIRE(sum.has_value());
+	REQUIRE(sum->get() == int64_max);
+	REQUIRE_FALSE(cbi::checked_add(any_t{ int64_max - 10 }, any_t{ 11 }).has_value());
+	REQUIRE_FALSE(cbi::checked_add(any_t{ int64_min }, any_t{ -1 }).has_value());
+
+	// the bound that can't overflow stays exact
+	const auto nonnegative = cbi::checked_add(cbi::Bounded<int64_t, 0, int64_max>{ 1 }, cbi::Bounded<int64_t, 5, int64_max>{ 5 });
+	static_assert(std::same_as<decltype(nonnegative), const std::optional<cbi::Bounded<int64_t, 5, int64_max>>>);
+	REQUIRE(nonnegative->get() == 6);
+
+	REQUIRE(cbi::checked_sub(any_t{ -1 }, any_t{ int64_max }).value().get() == int64_min);
+	REQUIRE_FALSE(cbi::checked_sub(any_t{ -5 }, any_t{ int64_max - 3 }).has_value());
+	REQUIRE_FALSE(cbi::checked_sub(any_t{ 0 }, any_t{ int64_min }).has_value());
+}
+
+TEST_CASE("checked mul reports overflow")
+{
+	const auto product = cbi::checked_mul(any_t{ 1ll << 31 }, any_t{ -(1ll << 31) });
+	REQUIRE(product.has_value());
+	REQUIRE(product->get() == -(1ll << 62));
+	REQUIRE_FALSE(cbi::checked_mul(any_t{ 1ll << 32 }, any_t{ 1ll << 31 }).has_value());
+	REQUIRE_FALSE(cbi::checked_mul(any_t{ int64_min }, any_t{ -1 }).has_value());
+
+	// unsigned operands never produce a negative product
+	using count_t = cbi::Bounded<uint64_t>;
+	const auto scaled = cbi::checked_mul(count_t{ 3 }, count_t{ 1ll << 40 });
+	static_assert(std::same_as<decltype(scaled), const std::optional<cbi::Bounded<int64_t, 0, int64_max>>>);
+	REQUIRE(scaled->get() == 3ll << 40);
+	REQUIRE_FALSE(cbi::checked_mul(count_t{ 1ull << 32 }, count_t{ 1ull << 31 }).has_value());
+}
@@ -0,0 +1,73 @@
+#include <string>
+#include "catch.hpp"
+#include "cbi/cbi.h"
+
+namespace
+{
+	// prices up to 100000.0000 in ticks of 0.0001, sizes up to 1000000.00
+	using price_t = cbi::fixed<cbi::Bounded<int64_t, 0, 1'000'000'000>, 4>;
+	using size_t_ = cbi::fixed<cbi::Bounded<int64_t, -100'000'000, 100'000'000>, 2>;
+}
+
+TEST_CASE("fixed converts from and to strings")
+{
+	constexpr auto price = price_t::from_string("1234.5");
+	static_assert(price.has_value());
+	static_assert(price->raw().get() == 12'345'000);
+	REQUIRE(price->to_string() == "1234.5000");
+
+	REQUIRE(size_t_::from_string("-0.05")->to_string() == "-0.05");
+	REQUIRE(size_t_::from_string("-12")->raw().get() == -1200);
+	REQUIRE(size_t_::from_string("999999.99").has_value());
+
+	REQUIRE_FALSE(size_t_::from_string("1000000.01").has_value());
+	REQUIRE_FALSE(size_t_::from_string("1.234").has_value());
+	REQUIRE_FALSE(size_t_::from_string("1.").has_value());
+	REQUIRE_FALSE(size_t_::from_string("").has_value());
+	REQUIRE_FALSE(size_t_::from_string("-").has_value());
+	REQUIRE_FALSE(size_t_::from_string("12a").has_value());
+	REQUIRE_FALSE(price_t::from_string("-1").has_value());
+	REQUIRE_FALSE(price_t::from_string("99999999999999999999").has_value());
+}
+
+TEST_CASE("fixed converts from and to doubles")
+{
+	REQUIRE(price_t::from_double(0.00026)->raw().get() == 3);
+	REQUIRE(price_t::from_double(99.99)->to_double() == Approx(99.99));
+	REQUIRE_FALSE(price_t::from_double(-0.01).has_value());
+	REQUIRE_FALSE(price_t::from_double(1e300).has_value());
+	REQUIRE_FALSE(price_t::from_double(std::nan("")).has_value());
+}
+
+TEST_CASE("fixed arithmetic tracks bounds through the raw values")
+{
+	const auto bid = *price_t::from_string("100.25");
+	const auto ask = *price_t::from_string("100.50");
+
+	const auto spread = ask - bid;
+	static_assert(std::same_as<decltype(spread), const cbi::fixed<cbi::Bounded<int64_t, -1'000'000'000, 1'000'000'000>, 4>>);
+	REQUIRE(spread.to_string() == "0.2500");
+	REQUIRE((bid + ask).to_string() == "200.7500");
+	REQUIRE((-spread).to_string() == "-0.2500");
+	REQUIRE(bid < ask);
+	REQUIRE(bid == *price_t::from_string("100.2500"));
+
+	const auto size = *size_t_::from_string("-3.5");
+	const auto notional = bid * size;
+	static_assert(decltype(notional)::scale == 6);
+	REQUIRE(notional.to_string() == "-350.875000");
+	REQUIRE(cbi::multiply<2>(bid, size).to_string() == "-350.87");
+	REQUIRE(cbi::rescale<8>(bid).to_string() == "100.25000000");
+}
+
+TEST_CASE("fixed division rescales the dividend")
+{
+	using lot_t = cbi::fixed<cbi::Bounded<int32_t, 1, 1'000'000>, 2>;
+	const auto notional = *cbi::fixed<cbi::Bounded<int64_t, 0, 1'000'000'000'000>, 4>::from_string("1000.0000");
+	const auto lots = *lot_t::from_string("3.00");
+
+	const auto average = notional / lots;
+	static_assert(decltype(average)::scale == 4);
+	REQUIRE(average.to_string() == "333.3333");
+	REQUIRE(cbi::divide<1>(notional, lots).to_string() == "333.3");
+}
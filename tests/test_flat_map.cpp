@@ -0,0 +1,148 @@
+#include <algorithm>
+#include <cstdint>
+#include <random>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include "catch.hpp"
+#include "cbi/cbi.h"
+
+struct cbi::details::flat_map_probe
+{
+	template <typename Map>
+	static std::size_t full_groups(const Map& map) { return map.full_groups(); }
+};
+
+TEST_CASE("flat_map narrow indices")
+{
+	using small_map = cbi::flat_map<uint32_t, int, 64>;
+	static_assert(std::same_as<small_map::entry_index::underlying_type, uint8_t>);
+	static_assert(std::same_as<small_map::slot_count_type, cbi::Bounded<uint8_t, 1, 64>>);
+
+	using map_64k = cbi::flat_map<uint32_t, int, 65536>;
+	static_assert(std::same_as<map_64k::entry_index::underlying_type, uint16_t>);
+
+	small_map map;
+	REQUIRE(map.slot_count() == 64);
+	REQUIRE(map.capacity() == 56);
+
+	const small_map rounded{ small_map::slot_count_type{ 20 } };
+	REQUIRE(rounded.slot_count() == 32);
+	REQUIRE(rounded.capacity() == 28);
+}
+
+TEST_CASE("flat_map insert, find and erase")
+{
+	cbi::flat_map<std::string, int, 32> map;
+	REQUIRE(map.empty());
+	REQUIRE(map.insert_or_assign("one", 1));
+	REQUIRE(map.insert_or_assign("two", 2));
+	REQUIRE(map.insert_or_assign("one", 11));
+	REQUIRE(map.size() == 2);
+	REQUIRE(*map.find("one") == 11);
+	REQUIRE(map.contains("two"));
+	REQUIRE(map.find("three") == nullptr);
+
+	REQUIRE(map.erase("one"));
+	REQUIRE(!map.erase("one"));
+	REQUIRE(map.find("one") == nullptr);
+	REQUIRE(*map.find("two") == 2);
+	REQUIRE(map.begin()->first == "two");
+
+	map.clear();
+	REQUIRE(map.empty());
+	REQUIRE(!map.contains("two"));
+}
+
+TEST_CASE("flat_map fills up to capacity")
+{
+	cbi::flat_map<uint64_t, uint64_t, 16> map;
+	for (uint64_t i = 0; i < map.capacity(); ++i)
+		REQUIRE(map.insert_or_assign(i, i * i));
+	REQUIRE(!map.insert_or_assign(100, 0));
+	REQUIRE(map.insert_or_assign(3, 0));
+	for (uint64_t i = 0; i < map.capacity(); ++i)
+		REQUIRE(*map.find(i) == (i == 3 ? 0 : i * i));
+}
+
+TEST_CASE("flat_map against std::unordered_map")
+{
+	// a runtime size under the maximum, with keys that collide in a plain % hash
+	using map_t = cbi::flat_map<uint32_t, uint32_t, 4096>;
+	map_t map{ map_t::slot_count_type{ 1000 } };
+	std::unordered_map<uint32_t, uint32_t> reference;
+
+	std::mt19937 rng{ 11 };
+	bool same = true;
+	for (int i = 0; i < 200000; ++i)
+	{
+		const uint32_t key = (rng() % 1500) * 1024;
+		const uint32_t value = rng();
+		switch (rng() % 3)
+		{
+		case 0:
+			if (reference.size() < map.capacity() || reference.contains(key))
+			{
+				same &= map.insert_or_assign(key, value);
+				reference[key] = value;
+			}
+			else
+			{
+				same &= !map.insert_or_assign(key, value);
+			}
+			break;
+		case 1:
+			same &= map.erase(key) == (reference.erase(key) == 1);
+			break;
+		default:
+		{
+			const uint32_t* found = map.find(key);
+			const auto expected = reference.find(key);
+			same &= expected == reference.end() ? found == nullptr : found != nullptr && *found == expected->second;
+		}
+		}
+		same &= map.size() == reference.size();
+	}
+	REQUIRE(same);
+
+	std::size_t visited = 0;
+	for (const auto& [key, value] : map)
+	{
+		REQUIRE(reference.at(key) == value);
+		++visited;
+	}
+	REQUIRE(visited == reference.size());
+}
+
+TEST_CASE("flat_map drops tombstones under churn")
+{
+	// constant live size, every step erases one key and inserts another
+	cbi::flat_map<uint32_t, uint32_t, 1024> map;
+	std::mt19937 rng{ 21 };
+	std::vector<uint32_t> keys;
+	while (keys.size() < 448)
+	{
+		const uint32_t key = rng();
+		if (!map.contains(key) && map.insert_or_assign(key, key))
+			keys.push_back(key);
+	}
+
+	std::size_t worst = 0;
+	bool found = true;
+	for (int i = 0; i < 200000; ++i)
+	{
+		const std::size_t at = rng() % keys.size();
+		found &= map.erase(keys[at]);
+		do
+			keys[at] = rng();
+		while (map.contains(keys[at]));
+		found &= map.insert_or_assign(keys[at], keys[at]);
+		if (i % 1000 == 0)
+			worst = std::max(worst, cbi::details::flat_map_probe::full_groups(map));
+	}
+	REQUIRE(found);
+	REQUIRE(map.size() == 448);
+	REQUIRE(worst <= 16);
+	for (const uint32_t key : keys)
+		REQUIRE(*map.find(key) == key);
+}
@@ -0,0 +1,71 @@
+#include <vector>
+#include "catch.hpp"
+#include "cbi/cbi.h"
+
+TEST_CASE("group by aggregate types")
+{
+	using key_t = cbi::Bounded<int8_t, 0, 9>;
+	using price_t = cbi::Bounded<int16_t, -100, 1000>;
+	using table_t = cbi::group_by_table<key_t, 1000, price_t>;
+
+	static_assert(table_t::size() == 10);
+	static_assert(std::same_as<table_t::count_type, cbi::Bounded<int16_t, 0, 1000>>);
+	static_assert(std::same_as<table_t::sum_type<0>, cbi::Bounded<int32_t, -100000, 1000000>>);
+
+	using positive_t = cbi::Bounded<int8_t, 1, 100>;
+	using small_table_t = cbi::group_by_table<key_t, 1, positive_t>;
+	static_assert(std::same_as<small_table_t::sum_type<0>, cbi::Bounded<int8_t, 0, 100>>);
+}
+
+TEST_CASE("group by aggregates")
+{
+	using key_t = cbi::Bounded<int32_t, 10, 13>;
+	using qty_t = cbi::Bounded<int32_t, 0, 50>;
+	using delta_t = cbi::Bounded<int8_t, -5, 5>;
+
+	const std::vector<key_t> keys{ key_t{ 10 }, key_t{ 12 }, key_t{ 10 }, key_t{ 13 }, key_t{ 10 } };
+	const std::vector<qty_t> qty{ qty_t{ 5 }, qty_t{ 7 }, qty_t{ 50 }, qty_t{ 0 }, qty_t{ 1 } };
+	const std::vector<delta_t> delta{ delta_t{ -5 }, delta_t{ 3 }, delta_t{ 2 }, delta_t{ 0 }, delta_t{ -1 } };
+
+	auto table = cbi::group_by<16>(std::span<const key_t>{ keys }, std::span<const qty_t>{ qty }, std::span<const delta_t>{ delta });
+
+	REQUIRE(table.count(key_t{ 10 }).get() == 3);
+	REQUIRE(table.count(key_t{ 11 }).get() == 0);
+	REQUIRE(table.sum<0>(key_t{ 10 }).get() == 56);
+	REQUIRE(table.sum<1>(key_t{ 10 }).get() == -4);
+	REQUIRE(table.min<0>(key_t{ 10 })->get() == 1);
+	REQUIRE(table.max<0>(key_t{ 10 })->get() == 50);
+	REQUIRE(table.min<1>(key_t{ 10 })->get() == -5);
+	REQUIRE(table.max<1>(key_t{ 12 })->get() == 3);
+	REQUIRE_FALSE(table.min<0>(key_t{ 11 }).has_value());
+	REQUIRE_FALSE(table.max<1>(key_t{ 11 }).has_value());
+	REQUIRE(table.sum<0>(key_t{ 11 }).get() == 0);
+}
+
+TEST_CASE("parallel group by")
+{
+	using key_t = cbi::Bounded<int16_t, -8, 7>;
+	using value_t = cbi::Bounded<int32_t, 0, 999>;
+	constexpr std::size_t rows = 400000;
+
+	std::vector<key_t> keys;
+	std::vector<value_t> values;
+	for (std::size_t i = 0; i < rows; ++i)
+	{
+		keys.push_back(key_t{ static_cast<int16_t>(static_cast<int>(i % 16) - 8) });
+		values.push_back(value_t{ static_cast<int32_t>(i % 1000) });
+	}
+
+	auto serial = cbi::group_by<rows>(std::span<const key_t>{ keys }, std::span<const value_t>{ values });
+	auto parallel = cbi::parallel_group_by<rows>(4, std::span<const key_t>{ keys }, std::span<const value_t>{ values });
+
+	for (int k = -8; k <= 7; ++k)
+	{
+		const key_t key{ static_cast<int16_t>(k) };
+		REQUIRE(parallel.count(key).get() == 25000);
+		REQUIRE(parallel.count(key).get() == serial.count(key).get());
+		REQUIRE(parallel.sum<0>(key).get() == serial.sum<0>(key).get());
+		REQUIRE(parallel.min<0>(key)->get() == serial.min<0>(key)->get());
+		REQUIRE(parallel.max<0>(key)->get() == serial.max<0>(key)->get());
+	}
+}
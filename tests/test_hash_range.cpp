@@ -0,0 +1,59 @@
+#include <cstdint>
+#include <limits>
+#include <vector>
+#include "catch.hpp"
+#include "cbi/cbi.h"
+
+TEST_CASE("reduce_to constant range")
+{
+	using index_t = cbi::Bounded<uint8_t, 0, 9>;
+	static_assert(std::same_as<decltype(cbi::reduce_to<index_t>(0)), index_t>);
+	static_assert(cbi::reduce_to<index_t>(0).get() == 0);
+	static_assert(cbi::reduce_to<index_t>(UINT64_MAX).get() == 9);
+
+	using signed_t = cbi::Bounded<int16_t, -5, 5>;
+	static_assert(cbi::reduce_to<signed_t>(0).get() == -5);
+	static_assert(cbi::reduce_to<signed_t>(UINT64_MAX).get() == 5);
+
+	using full_t = cbi::Bounded<int64_t>;
+	static_assert(cbi::reduce_to<full_t>(0).get() == std::numeric_limits<int64_t>::min());
+	static_assert(cbi::reduce_to<full_t>(UINT64_MAX).get() == std::numeric_limits<int64_t>::max());
+
+	// evenly spread hashes land evenly, and in order
+	std::vector<int> counts(11);
+	int previous = -5;
+	bool ordered = true;
+	const uint64_t step = UINT64_MAX / 1100;
+	for (uint64_t i = 0; i < 1100; ++i)
+	{
+		const int value = cbi::reduce_to<signed_t>(i * step + step / 2).get();
+		ordered &= value >= previous;
+		previous = value;
+		++counts[value + 5];
+	}
+	REQUIRE(ordered);
+	for (const int count : counts)
+		REQUIRE(count == 100);
+}
+
+TEST_CASE("reduce_to runtime range")
+{
+	using size_t_ = cbi::Bounded<uint32_t, 1, 65536>;
+	static_assert(std::same_as<decltype(cbi::reduce_to(0, size_t_{ 1 })), cbi::Bounded<uint16_t, 0, 65535>>);
+
+	for (const uint32_t n : { 1u, 2u, 3u, 1000u, 65535u, 65536u })
+	{
+		REQUIRE(cbi::reduce_to(0, size_t_{ n }).get() == 0);
+		REQUIRE(cbi::reduce_to(UINT64_MAX, size_t_{ n }).get() == n - 1);
+
+		std::vector<int> counts(n);
+		const uint64_t step = UINT64_MAX / (uint64_t{ n } * 4);
+		for (uint64_t i = 0; i < uint64_t{ n } * 4; ++i)
+			++counts[cbi::reduce_to(i * step + step / 2, size_t_{ n }).get()];
+
+		bool even = true;
+		for (const int count : counts)
+			even &= count == 4;
+		REQUIRE(even);
+	}
+}
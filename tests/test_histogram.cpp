@@ -0,0 +1,67 @@
+#include <random>
+#include <vector>
+#include "catch.hpp"
+#include "cbi/cbi.h"
+
+TEST_CASE("histogram counter type")
+{
+	using num_t = cbi::Bounded<int8_t, 0, 9>;
+	const std::vector<num_t> small(200, num_t{ 0 });
+	auto counts = cbi::histogram(std::span<const num_t, 200>{ small.data(), 200 });
+	static_assert(std::same_as<decltype(counts)::counter_type, uint8_t>);
+	static_assert(decltype(counts)::size() == 10);
+
+	std::vector<num_t> dynamic(3, num_t{ 1 });
+	auto dynamic_counts = cbi::histogram(std::span<const num_t>{ dynamic });
+	static_assert(std::same_as<decltype(dynamic_counts)::counter_type, std::size_t>);
+	REQUIRE(dynamic_counts[num_t{ 1 }] == 3);
+}
+
+TEST_CASE("histogram never overflows the counter")
+{
+	using num_t = cbi::Bounded<int32_t, -3, 3>;
+	const std::vector<num_t> values(255, num_t{ -3 });
+	auto counts = cbi::histogram(std::span<const num_t, 255>{ values.data(), 255 });
+	static_assert(std::same_as<decltype(counts)::counter_type, uint8_t>);
+	REQUIRE(counts[num_t{ -3 }] == 255);
+	REQUIRE(counts[num_t{ 3 }] == 0);
+}
+
+TEST_CASE("histogram matches naive counting")
+{
+	using small_t = cbi::Bounded<int16_t, -50, 50>;
+	using large_t = cbi::Bounded<int32_t, 0, 100000>;
+
+	std::mt19937 rng{ 7 };
+	std::vector<small_t> small;
+	std::vector<large_t> large;
+	for (int i = 0; i < 10001; ++i)
+	{
+		small.push_back(small_t{ static_cast<int16_t>(static_cast<int>(rng() % 101) - 50) });
+		large.push_back(large_t{ static_cast<int32_t>(rng() % 100001) });
+	}
+
+	std::vector<std::size_t> small_expected(101), large_expected(100001);
+	for (auto v : small) ++small_expected[v.get() + 50];
+	for (auto v : large) ++large_expected[v.get()];
+
+	REQUIRE(cbi::histogram(std::span<const small_t>{ small }).counts == small_expected);
+	REQUIRE(cbi::histogram(std::span<const large_t>{ large }).counts == large_expected);
+}
+
+TEST_CASE("parallel histogram")
+{
+	using num_t = cbi::Bounded<int32_t, 400, 599>;
+	std::vector<num_t> values;
+	for (int i = 0; i < 1000003; ++i)
+		values.push_back(num_t{ 400 + i % 200 });
+
+	auto counts = cbi::histogram(std::span<const num_t>{ values }, 4);
+	REQUIRE(counts[num_t{ 400 }] == 5001);
+	REQUIRE(counts[num_t{ 402 }] == 5001);
+	REQUIRE(counts[num_t{ 403 }] == 5000);
+	REQUIRE(counts.counts == cbi::histogram(std::span<const num_t>{ values }).counts);
+
+	auto single = cbi::histogram(std::span<const num_t>{ values }.first(10), 8);
+	REQUIRE(single[num_t{ 405 }] == 1);
+}
@@ -0,0 +1,104 @@
+#include <span>
+#include <vector>
+#include "catch.hpp"
+#include "cbi/cbi.h"
+
+TEST_CASE("negation mirrors the bounds")
+{
+	const auto negated = -cbi::Bounded<int64_t, -5, 300>{ 7 };
+	static_assert(std::same_as<decltype(negated), const cbi::Bounded<int16_t, -300, 5>>);
+	REQUIRE(negated.get() == -7);
+	REQUIRE((-cbi::Bounded<int8_t, -128, 0>{ -128 }).get() == 128);
+}
+
+TEST_CASE("min and max tighten the bounds")
+{
+	const cbi::Bounded<int32_t, 0, 100> fst{ 70 };
+	const cbi::Bounded<int64_t, 50, 200> sec{ 60 };
+
+	const auto low = cbi::min(fst, sec);
+	const auto high = cbi::max(fst, sec);
+	static_assert(std::same_as<decltype(low), const cbi::Bounded<int8_t, 0, 100>>);
+	static_assert(std::same_as<decltype(high), const cbi::Bounded<uint8_t, 50, 200>>);
+	REQUIRE(low.get() == 60);
+	REQUIRE(high.get() == 70);
+
+	// disjoint ranges are decided by the bounds
+	const auto decided = cbi::min(cbi::Bounded<int32_t, -10, -1>{ -3 }, cbi::Bounded<int32_t, 0, 9>{ 4 });
+	static_assert(std::same_as<decltype(decided), const cbi::Bounded<int8_t, -10, -1>>);
+	REQUIRE(decided.get() == -3);
+}
+
+TEST_CASE("clamp narrows into the target range")
+{
+	using raw_t = cbi::Bounded<int64_t, std::numeric_limits<int64_t>::min(), std::numeric_limits<int64_t>::max()>;
+	const auto clamped = cbi::clamp<0, 255>(raw_t{ -40 });
+	static_assert(std::same_as<decltype(clamped), const cbi::Bounded<uint8_t, 0, 255>>);
+	REQUIRE(clamped.get() == 0);
+	REQUIRE(cbi::clamp<0, 255>(raw_t{ 1000 }).get() == 255);
+	REQUIRE(cbi::clamp<0, 255>(raw_t{ 17 }).get() == 17);
+
+	// the input bounds win where they are tighter
+	const auto tight = cbi::clamp<-1000, 1000>(cbi::Bounded<int32_t, 10, 5000>{ 20 });
+	static_assert(std::same_as<decltype(tight), const cbi::Bounded<int16_t, 10, 1000>>);
+	REQUIRE(tight.get() == 20);
+
+	// a clamp range outside of B's range leaves one possible result
+	using small_t = cbi::Bounded<int8_t, 0, 10>;
+	static_assert(cbi::clamp<1000, 2000>(small_t{ 5 }).get() == 1000);
+	static_assert(cbi::clamp<-2000, -1000>(small_t{ 5 }).get() == -1000);
+	REQUIRE(cbi::clamp<1000, 2000>(small_t{ 5 }).get() == 1000);
+
+	// a clamp range wider than B's type
+	using byte_t = cbi::Bounded<uint8_t, 0, 255>;
+	static_assert(cbi::clamp<200, 300>(byte_t{ 5 }).get() == 200);
+	static_assert(cbi::clamp<-300, 100>(byte_t{ 250 }).get() == 100);
+	static_assert(cbi::clamp<-300, 300>(byte_t{ 250 }).get() == 250);
+}
+
+TEST_CASE("abs folds the sign into the bounds")
+{
+	const auto mixed = cbi::abs(cbi::Bounded<int32_t, -5, 3>{ -4 });
+	static_assert(std::same_as<decltype(mixed), const cbi::Bounded<int8_t, 0, 5>>);
+	REQUIRE(mixed.get() == 4);
+	REQUIRE(cbi::abs(cbi::Bounded<int32_t, -5, 3>{ 3 }).get() == 3);
+
+	const auto negative = cbi::abs(cbi::Bounded<int32_t, -90, -10>{ -12 });
+	static_assert(std::same_as<decltype(negative), const cbi::Bounded<int8_t, 10, 90>>);
+	REQUIRE(negative.get() == 12);
+
+	const auto wide = cbi::abs(cbi::Bounded<int8_t, -128, 127>{ -128 });
+	static_assert(std::same_as<decltype(wide), const cbi::Bounded<uint8_t, 0, 128>>);
+	REQUIRE(wide.get() == 128);
+
+	// the upper bound is the larger magnitude
+	const auto lopsided = cbi::abs(cbi::Bounded<int32_t, -5, 300>{ 300 });
+	static_assert(std::same_as<decltype(lopsided), const cbi::Bounded<int16_t, 0, 300>>);
+	REQUIRE(lopsided.get() == 300);
+	static_assert(cbi::abs(cbi::Bounded<int32_t, -5, 300>{ -5 }).get() == 5);
+}
+
+TEST_CASE("span forms apply element wise")
+{
+	using in_t = cbi::Bounded<int32_t, -1000, 1000>;
+	std::vector<in_t> values;
+	for (int i = -1000; i <= 1000; i += 7)
+		values.push_back(in_t{ i });
+
+	std::vector<cbi::Bounded<int8_t, -100, 100>> clamped(values.size(), cbi::Bounded<int8_t, -100, 100>{ 0 });
+	cbi::clamp<-100, 100>(std::span<const in_t>{ values }, clamped);
+
+	std::vector<cbi::Bounded<int16_t, 0, 1000>> magnitudes(values.size(), cbi::Bounded<int16_t, 0, 1000>{ 0 });
+	cbi::abs(std::span<const in_t>{ values }, magnitudes);
+
+	std::vector<cbi::Bounded<int16_t, -1000, 1000>> lowest(values.size(), cbi::Bounded<int16_t, -1000, 1000>{ 0 });
+	cbi::min(std::span<const in_t>{ values }, std::span<const in_t>{ values }, lowest);
+
+	for (std::size_t i = 0; i < values.size(); ++i)
+	{
+		const int value = values[i].get();
+		REQUIRE(clamped[i].get() == std::clamp(value, -100, 100));
+		REQUIRE(magnitudes[i].get() == std::abs(value));
+		REQUIRE(lowest[i].get() == value);
+	}
+}
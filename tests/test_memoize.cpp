@@ -0,0 +1,91 @@
+#include <atomic>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+#include "catch.hpp"
+#include "cbi/cbi.h"
+
+namespace
+{
+	using tick_t = cbi::Bounded<int32_t, -50000, 50000>;
+}
+
+TEST_CASE("memoize computes every value once")
+{
+	int calls = 0;
+	const auto curve = cbi::memoize<tick_t>([&calls](tick_t tick)
+	{
+		++calls;
+		return static_cast<double>(tick.get()) * 0.5;
+	});
+
+	REQUIRE_FALSE(curve.contains(tick_t{ 10 }));
+	REQUIRE(curve(tick_t{ 10 }) == 5.0);
+	REQUIRE(curve.contains(tick_t{ 10 }));
+	REQUIRE(curve(tick_t{ 10 }) == 5.0);
+	REQUIRE(curve(tick_t{ -50000 }) == -25000.0);
+	REQUIRE(calls == 2);
+}
+
+TEST_CASE("memoize non trivial results")
+{
+	using small_t = cbi::Bounded<int8_t, 0, 9>;
+	const auto names = cbi::memoize<small_t>([](small_t value) { return std::string(static_cast<std::size_t>(value.get()), 'x'); });
+	REQUIRE(names(small_t{ 3 }) == "xxx");
+	REQUIRE(names(small_t{ 3 }) == "xxx");
+	REQUIRE(names(small_t{ 0 }).empty());
+}
+
+TEST_CASE("memoize from several threads")
+{
+	std::atomic<int> calls = 0;
+	const auto square = cbi::memoize<tick_t>([&calls](tick_t tick)
+	{
+		++calls;
+		return static_cast<int64_t>(tick.get()) * tick.get();
+	});
+
+	std::atomic<bool> ok = true;
+	{
+		std::vector<std::jthread> threads;
+		for (int t = 0; t < 4; ++t)
+		{
+			threads.emplace_back([&]
+			{
+				for (int32_t i = -1000; i <= 1000; ++i)
+				{
+					if (square(tick_t{ i }) != static_cast<int64_t>(i) * i)
+						ok = false;
+				}
+			});
+		}
+	}
+
+	REQUIRE(ok);
+	REQUIRE(calls >= 2001);
+	const int before = calls;
+	for (int32_t i = -1000; i <= 1000; ++i)
+		REQUIRE(square.contains(tick_t{ i }));
+	REQUIRE(square(tick_t{ 7 }) == 49);
+	REQUIRE(calls == before);
+}
+
+TEST_CASE("memoize retries after an exception")
+{
+	using small_t = cbi::Bounded<int8_t, 0, 9>;
+	int calls = 0;
+	const auto flaky = cbi::memoize<small_t>([&calls](small_t value)
+	{
+		if (++calls == 1)
+			throw std::runtime_error("first call fails");
+		return value.get() * 2;
+	});
+
+	REQUIRE_THROWS_AS(flaky(small_t{ 4 }), std::runtime_error);
+	REQUIRE_FALSE(flaky.contains(small_t{ 4 }));
+	REQUIRE(flaky(small_t{ 4 }) == 8);
+	REQUIRE(flaky.contains(small_t{ 4 }));
+	REQUIRE(flaky(small_t{ 4 }) == 8);
+	REQUIRE(calls == 2);
+}
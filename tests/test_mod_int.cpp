@@ -0,0 +1,87 @@
+#include <cstdint>
+#include <vector>
+#include "catch.hpp"
+#include "cbi/cbi.h"
+
+TEST_CASE("mod_int arithmetic")
+{
+	using m7 = cbi::mod_int<7>;
+	static_assert(std::same_as<m7::value_type, cbi::Bounded<uint8_t, 0, 6>>);
+
+	constexpr auto five = m7::reduce(12);
+	static_assert(five.get().get() == 5);
+	static_assert((five + five).get().get() == 3);
+	static_assert((m7::reduce(2) - five).get().get() == 4);
+	static_assert((-five).get().get() == 2);
+	static_assert((five * five).get().get() == 4);
+	static_assert(m7::from(cbi::Bounded<int32_t, -100, 100>{ -1 }) == m7::reduce(6));
+	static_assert(m7::from(cbi::Bounded<int8_t, 0, 6>{ 3 }) == m7::reduce(3));
+}
+
+TEST_CASE("mod_int reduction matches %")
+{
+	using big = cbi::mod_int<(1ull << 32) - 5>;
+	using pow2 = cbi::mod_int<1ull << 32>;
+	using one = cbi::mod_int<1>;
+
+	uint64_t state = 0x9E3779B97F4A7C15ull;
+	for (int i = 0; i < 100000; ++i)
+	{
+		state ^= state << 13;
+		state ^= state >> 7;
+		state ^= state << 17;
+		REQUIRE(big::reduce(state).get().get() == state % big::modulus);
+		REQUIRE(pow2::reduce(state).get().get() == state % pow2::modulus);
+		REQUIRE(one::reduce(state).get().get() == 0);
+
+		const auto fst = big::reduce(state), sec = big::reduce(state >> 17);
+		REQUIRE((fst * sec).get().get() == uint64_t{ fst.get().get() } * sec.get().get() % big::modulus);
+	}
+	REQUIRE(big::reduce(UINT64_MAX).get().get() == UINT64_MAX % big::modulus);
+}
+
+TEST_CASE("mod_ring with a runtime modulus")
+{
+	using ring_t = cbi::mod_ring<1'000'000>;
+	for (const uint32_t n : { 1u, 2u, 3u, 1000u, 999'983u, 1'000'000u })
+	{
+		const ring_t ring{ ring_t::modulus_type{ n } };
+		REQUIRE(ring.modulus().get() == n);
+
+		for (const uint64_t value : std::initializer_list<uint64_t>{ 0, 1, 999'999, 123'456'789'012, UINT64_MAX })
+			REQUIRE(ring.reduce(value).get() == value % n);
+
+		const auto fst = ring.reduce(777'777), sec = ring.reduce(555'555);
+		REQUIRE(ring.add(fst, sec).get() == (777'777ull + 555'555) % n);
+		REQUIRE(ring.sub(sec, fst).get() == (555'555ull % n + n - 777'777ull % n) % n);
+		REQUIRE(ring.mul(fst, sec).get() == (777'777ull % n) * (555'555ull % n) % n);
+		REQUIRE(ring.from(cbi::Bounded<int64_t>{ -5 }).get() == (n - 5 % n) % n);
+	}
+}
+
+TEST_CASE("mod batch forms")
+{
+	std::vector<uint64_t> values;
+	for (uint64_t i = 0; i < 1000; ++i)
+		values.push_back(i * 0x9E3779B97F4A7C15ull);
+
+	using m = cbi::mod_int<1'000'003>;
+	std::vector<m> reduced(values.size(), m::reduce(0));
+	m::reduce(values, reduced);
+	std::vector<m> squares(values.size(), m::reduce(0));
+	m::mul(reduced, reduced, squares);
+
+	const cbi::mod_ring<1u << 20> ring{ cbi::mod_ring<1u << 20>::modulus_type{ 65'521 } };
+	using value_t = cbi::mod_ring<1u << 20>::value_type;
+	std::vector<value_t> residues(values.size(), value_t{ 0 });
+	ring.reduce(values, residues);
+	std::vector<value_t> products(values.size(), value_t{ 0 });
+	ring.mul(residues, residues, products);
+
+	for (std::size_t i = 0; i < values.size(); ++i)
+	{
+		REQUIRE(reduced[i].get().get() == values[i] % 1'000'003);
+		REQUIRE(squares[i].get().get() == (values[i] % 1'000'003) * (values[i] % 1'000'003) % 1'000'003);
+		REQUIRE(products[i].get() == (values[i] % 65'521) * (values[i] % 65'521) % 65'521);
+	}
+}
@@ -0,0 +1,95 @@
+#include <unordered_set>
+#include "catch.hpp"
+#include "cbi/cbi.h"
+
+namespace
+{
+	using priority_t = cbi::Bounded<int8_t, 0, 7>;
+	using port_t = cbi::Bounded<int32_t, 0, 65535>;
+	using delta_t = cbi::Bounded<int16_t, -500, 500>;
+	using flag_t = cbi::Bounded<int8_t, 0, 1>;
+	using constant_t = cbi::Bounded<int8_t, 3, 3>;
+}
+
+TEST_CASE("packed record layout")
+{
+	using record_t = cbi::packed_record<priority_t, port_t, delta_t, flag_t>;
+	static_assert(record_t::bits == 3 + 16 + 10 + 1);
+	static_assert(std::same_as<record_t::storage_type, uint32_t>);
+	static_assert(sizeof(record_t) == 4);
+
+	static_assert(std::same_as<cbi::packed_record<flag_t, constant_t>::storage_type, uint8_t>);
+	static_assert(std::same_as<cbi::packed_record<cbi::Bounded<int64_t>>::storage_type, uint64_t>);
+
+	using wide_t = cbi::packed_record<cbi::Bounded<int64_t, 0, (1ll << 40) - 1>, port_t, port_t>;
+	static_assert(wide_t::words == 2);
+	static_assert(sizeof(wide_t) == 16);
+}
+
+TEST_CASE("packed record get and set")
+{
+	using record_t = cbi::packed_record<priority_t, port_t, constant_t, delta_t, flag_t>;
+	constexpr record_t record{ priority_t{ 5 }, port_t{ 8080 }, constant_t{ 3 }, delta_t{ -500 }, flag_t{ 1 } };
+	static_assert(record.get<0>().get() == 5);
+	static_assert(record.get<1>().get() == 8080);
+	static_assert(record.get<2>().get() == 3);
+	static_assert(record.get<3>().get() == -500);
+	static_assert(record.get<4>().get() == 1);
+
+	record_t copy = record;
+	copy.set<3>(delta_t{ 499 });
+	copy.set<0>(priority_t{ 0 });
+	REQUIRE(copy.get<0>().get() == 0);
+	REQUIRE(copy.get<1>().get() == 8080);
+	REQUIRE(copy.get<3>().get() == 499);
+	REQUIRE(copy.get<4>().get() == 1);
+
+	const record_t empty;
+	REQUIRE(empty.get<3>().get() == -500);
+}
+
+TEST_CASE("packed record spanning several words")
+{
+	using big_t = cbi::Bounded<int64_t, -(1ll << 40), 1ll << 40>;
+	using record_t = cbi::packed_record<port_t, big_t, big_t, flag_t>;
+	static_assert(record_t::words == 2);
+
+	record_t record{ port_t{ 1 }, big_t{ -(1ll << 40) }, big_t{ 123456789012 }, flag_t{ 1 } };
+	REQUIRE(record.get<0>().get() == 1);
+	REQUIRE(record.get<1>().get() == -(1ll << 40));
+	REQUIRE(record.get<2>().get() == 123456789012);
+	REQUIRE(record.get<3>().get() == 1);
+}
+
+TEST_CASE("packed record compares and hashes as one integer")
+{
+	using record_t = cbi::packed_record<priority_t, port_t>;
+	const record_t low{ priority_t{ 1 }, port_t{ 65535 } };
+	const record_t high{ priority_t{ 2 }, port_t{ 0 } };
+	REQUIRE(low < high);
+	REQUIRE(low != high);
+	REQUIRE(low == record_t{ priority_t{ 1 }, port_t{ 65535 } });
+
+	std::unordered_set<record_t> set{ low, high, low };
+	REQUIRE(set.size() == 2);
+
+	using wide_t = cbi::packed_record<cbi::Bounded<int64_t>, flag_t>;
+	std::unordered_set<wide_t> wide{ wide_t{ cbi::Bounded<int64_t>{ 5 }, flag_t{ 0 } } };
+	REQUIRE(wide.contains(wide_t{ cbi::Bounded<int64_t>{ 5 }, flag_t{ 0 } }));
+}
+
+TEST_CASE("packed record from raw")
+{
+	using record_t = cbi::packed_record<cbi::Bounded<int8_t, 0, 5>, flag_t>;
+	static_assert(record_t::bits == 4);
+	REQUIRE(record_t::from_raw(0b1011).has_value());
+	REQUIRE(record_t::from_raw(0b1011)->get<0>().get() == 5);
+	REQUIRE_FALSE(record_t::from_raw(0b1101).has_value());
+	REQUIRE_FALSE(record_t::from_raw(0b1000'1011).has_value());
+
+	// bits left over at the low end of each word of a wide record
+	using wide_t = cbi::packed_record<cbi::Bounded<int64_t, 0, (int64_t{ 1 } << 40) - 1>, cbi::Bounded<int64_t, 0, (int64_t{ 1 } << 40) - 1>>;
+	static_assert(wide_t::words == 2);
+	REQUIRE(wide_t::from_raw({ uint64_t{ 3 } << 24, uint64_t{ 5 } << 24 }).has_value());
+	REQUIRE_FALSE(wide_t::from_raw({ uint64_t{ 3 } << 24, 1 }).has_value());
+}
@@ -0,0 +1,89 @@
+#include <vector>
+#include "catch.hpp"
+#include "cbi/cbi.h"
+
+namespace
+{
+	using pkey_t = cbi::Bounded<int32_t, -100, 899>;
+
+	struct row
+	{
+		pkey_t key;
+		int32_t payload;
+	};
+}
+
+TEST_CASE("partition layout")
+{
+	using layout = cbi::partition_layout<pkey_t, 2>;
+	static_assert(layout::key_bits == 10);
+	static_assert(layout::shift == 8);
+	static_assert(layout::size() == 4);
+	static_assert(std::same_as<layout::key_type<0>, cbi::Bounded<int32_t, -100, 155>>);
+	static_assert(std::same_as<layout::key_type<3>, cbi::Bounded<int32_t, 668, 899>>);
+	static_assert(layout::index_of(pkey_t{ 156 }) == 1);
+
+	using narrow_t = cbi::Bounded<int8_t, 0, 5>;
+	static_assert(cbi::partition_layout<narrow_t, 8>::size() == 6);
+	static_assert(cbi::default_partition_bits<narrow_t> == 3);
+	static_assert(cbi::default_partition_bits<pkey_t> == 8);
+	static_assert(std::same_as<cbi::partition_layout<narrow_t, 8>::key_type<4>, cbi::Bounded<int8_t, 4, 4>>);
+}
+
+TEST_CASE("partition rows")
+{
+	std::vector<row> rows;
+	for (int32_t i = 0; i < 5000; ++i)
+		rows.push_back(row{ pkey_t{ (i * 37) % 1000 - 100 }, i });
+
+	const auto parts = cbi::partition<2>(std::span<const row>{ rows }, &row::key);
+	static_assert(parts.size() == 4);
+
+	std::size_t total = 0;
+	parts.for_each([&](auto index, std::span<const row> part)
+	{
+		using narrowed_t = decltype(parts)::key_type<decltype(index)::value>;
+		for (const row& r : part)
+		{
+			REQUIRE(r.key.get() >= narrowed_t::lower_bound());
+			REQUIRE(r.key.get() <= narrowed_t::upper_bound());
+			REQUIRE(cbi::partition_layout<pkey_t, 2>::narrow<decltype(index)::value>(r.key).get() == r.key.get());
+		}
+		total += part.size();
+	});
+	REQUIRE(total == rows.size());
+
+	// scatter is stable within a partition
+	for (std::size_t p = 0; p < parts.size(); ++p)
+	{
+		const auto part = parts[p];
+		for (std::size_t i = 1; i < part.size(); ++i)
+			REQUIRE(part[i - 1].payload < part[i].payload);
+	}
+}
+
+TEST_CASE("parallel partition matches serial")
+{
+	std::vector<pkey_t> keys;
+	for (int32_t i = 0; i < 300000; ++i)
+		keys.push_back(pkey_t{ static_cast<int32_t>(i * 7919ll % 1000) - 100 });
+
+	const auto serial = cbi::partition(std::span<const pkey_t>{ keys });
+	const auto parallel = cbi::partition(std::span<const pkey_t>{ keys }, 4);
+	static_assert(serial.size() == 250);
+
+	for (std::size_t p = 0; p < serial.size(); ++p)
+	{
+		REQUIRE(serial[p].size() == parallel[p].size());
+		REQUIRE(std::equal(serial[p].begin(), serial[p].end(), parallel[p].begin(),
+			[](pkey_t fst, pkey_t sec) { return fst.get() == sec.get(); }));
+	}
+}
+
+TEST_CASE("partition empty input")
+{
+	const std::vector<pkey_t> keys;
+	const auto parts = cbi::partition<4>(std::span<const pkey_t>{ keys });
+	REQUIRE(parts.all().empty());
+	REQUIRE(parts[0].empty());
+}
@@ -0,0 +1,101 @@
+#include <cstdint>
+#include <random>
+#include <vector>
+#include "catch.hpp"
+#include "cbi/cbi.h"
+
+namespace
+{
+	// Every value of B is drawn within 10% of its expected count.
+	template <typename B, typename Draw>
+	void check_uniform(Draw draw)
+	{
+		constexpr std::size_t values = static_cast<std::size_t>(B::upper_bound() - B::lower_bound()) + 1;
+		constexpr std::size_t samples = values * 4000;
+
+		std::vector<std::size_t> counts(values);
+		for (const B value : draw(samples))
+			++counts[static_cast<std::size_t>(value.get() - B::lower_bound())];
+
+		bool even = true;
+		for (const std::size_t count : counts)
+			even &= count > 3600 && count < 4400;
+		REQUIRE(even);
+	}
+
+	template <typename B, typename G>
+	void check_scalar(G& rng)
+	{
+		check_uniform<B>([&rng](const std::size_t samples)
+			{
+				std::vector<B> res;
+				for (std::size_t i = 0; i < samples; ++i)
+					res.push_back(cbi::uniform<B>(rng));
+				return res;
+			});
+	}
+
+	template <typename B, typename G>
+	void check_batch(G& rng)
+	{
+		check_uniform<B>([&rng](const std::size_t samples)
+			{
+				std::vector<B> res(samples + 3, B{ B::lower_bound() });
+				cbi::uniform<B>(rng, std::span<B>{ res });
+				return res;
+			});
+	}
+}
+
+TEST_CASE("uniform scalar draws")
+{
+	std::mt19937_64 rng64{ 1 };
+	std::mt19937 rng32{ 2 };
+
+	check_scalar<cbi::Bounded<int8_t, -3, 2>>(rng64);
+	check_scalar<cbi::Bounded<int8_t, -3, 2>>(rng32);
+	check_scalar<cbi::Bounded<uint8_t, 10, 25>>(rng64);
+	check_scalar<cbi::Bounded<uint8_t, 10, 25>>(rng32);
+	check_scalar<cbi::Bounded<int16_t, -50, 49>>(rng64);
+
+	const auto constant = cbi::uniform<cbi::Bounded<int32_t, 7, 7>>(rng64);
+	REQUIRE(constant.get() == 7);
+}
+
+TEST_CASE("uniform batch draws")
+{
+	std::mt19937_64 rng64{ 3 };
+	std::mt19937 rng32{ 4 };
+
+	check_batch<cbi::Bounded<int8_t, -3, 2>>(rng64);
+	check_batch<cbi::Bounded<int8_t, -3, 2>>(rng32);
+	check_batch<cbi::Bounded<uint8_t, 0, 1>>(rng64);
+	check_batch<cbi::Bounded<uint8_t, 10, 25>>(rng32);
+	check_batch<cbi::Bounded<int16_t, -50, 49>>(rng64);
+	check_batch<cbi::Bounded<int32_t, 0, 999>>(rng64);
+	check_batch<cbi::Bounded<int32_t, 5, 5>>(rng64);
+}
+
+TEST_CASE("uniform wide ranges")
+{
+	std::mt19937_64 rng64{ 5 };
+	std::mt19937 rng32{ 6 };
+
+	// the top bits must vary too, not only the bits a single 32 bit draw covers
+	bool high_seen = false, negative_seen = false, top_seen = false;
+	std::vector<cbi::Bounded<int64_t>> full(1000, cbi::Bounded<int64_t>{ 0 });
+	cbi::uniform(rng32, std::span{ full });
+	for (int i = 0; i < 1000; ++i)
+	{
+		negative_seen |= full[i].get() < 0;
+		high_seen |= cbi::uniform<cbi::Bounded<uint64_t>>(rng32).get() > (uint64_t{ 1 } << 62);
+
+		const auto value = cbi::uniform<cbi::Bounded<int64_t, 0, 3'000'000'000'000>>(rng64);
+		REQUIRE(value.get() >= 0);
+		REQUIRE(value.get() <= 3'000'000'000'000);
+		top_seen |= value.get() > 2'000'000'000'000;
+	}
+	REQUIRE(negative_seen);
+	REQUIRE(high_seen);
+	REQUIRE(top_seen);
+}
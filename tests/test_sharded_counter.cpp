@@ -0,0 +1,80 @@
+#include <thread>
+#include <vector>
+#include "catch.hpp"
+#include "cbi/cbi.h"
+
+TEST_CASE("sharded counter result type")
+{
+	using shard_t = cbi::Bounded<int32_t, 0, 1000000>;
+	using counter_t = cbi::sharded_counter<shard_t, 64>;
+	static_assert(std::same_as<counter_t::result_type, cbi::Bounded<int32_t, 0, 64000000>>);
+
+	using wide_t = cbi::Bounded<int32_t, -100, std::numeric_limits<int32_t>::max()>;
+	static_assert(std::same_as<cbi::sharded_counter<wide_t, 2>::result_type,
+		cbi::Bounded<int64_t, -200, 2ll * std::numeric_limits<int32_t>::max()>>);
+}
+
+TEST_CASE("sharded counter registration")
+{
+	using shard_t = cbi::Bounded<int16_t, 0, 100>;
+	using delta_t = cbi::Bounded<int8_t, 0, 100>;
+	cbi::sharded_counter<shard_t, 2> counter;
+
+	auto fst = counter.register_thread();
+	auto sec = counter.register_thread();
+	REQUIRE(fst.has_value());
+	REQUIRE(sec.has_value());
+	REQUIRE_FALSE(counter.register_thread().has_value());
+
+	REQUIRE(fst->add(delta_t{ 60 }));
+	REQUIRE_FALSE(fst->add(delta_t{ 60 }));
+	REQUIRE(fst->get().get() == 100);
+	REQUIRE(sec->add(delta_t{ 7 }));
+	REQUIRE(counter.read().get() == 107);
+
+	sec.reset();
+	auto third = counter.register_thread();
+	REQUIRE(third.has_value());
+	REQUIRE(third->get().get() == 7);
+	REQUIRE(counter.read().get() == 107);
+}
+
+TEST_CASE("sharded counter reject")
+{
+	using shard_t = cbi::Bounded<int32_t, -5, 5>;
+	using delta_t = cbi::Bounded<int32_t, -10, 10>;
+	cbi::sharded_counter<shard_t, 1, cbi::overflow_policy::reject> counter;
+	auto shard = counter.register_thread();
+
+	REQUIRE(shard->sub(delta_t{ 5 }));
+	REQUIRE_FALSE(shard->sub(delta_t{ 1 }));
+	REQUIRE(counter.read().get() == -5);
+}
+
+TEST_CASE("sharded counter concurrent")
+{
+	using shard_t = cbi::Bounded<int64_t, 0, 1000000>;
+	using delta_t = cbi::Bounded<int8_t, 1, 1>;
+	cbi::sharded_counter<shard_t, 4> counter;
+
+	{
+		std::vector<std::jthread> threads;
+		for (int t = 0; t < 4; ++t)
+		{
+			threads.emplace_back([&]
+			{
+				auto shard = counter.register_thread();
+				for (int i = 0; i < 100000; ++i)
+					shard->add(delta_t{ 1 });
+			});
+		}
+		for (int i = 0; i < 100; ++i)
+		{
+			const auto partial = counter.read().get();
+			REQUIRE(partial >= 0);
+			REQUIRE(partial <= 400000);
+		}
+	}
+
+	REQUIRE(counter.read().get() == 400000);
+}
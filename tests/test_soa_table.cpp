@@ -0,0 +1,71 @@
+#include <vector>
+#include "catch.hpp"
+#include "cbi/cbi.h"
+
+namespace
+{
+	using region_t = cbi::Bounded<int8_t, 0, 11>;
+	using amount_t = cbi::Bounded<int32_t, -1000000, 1000000>;
+	using flag_t = cbi::Bounded<int8_t, 0, 1>;
+	using table_t = cbi::soa_table<region_t, amount_t, cbi::bit_packed<flag_t>, cbi::bit_packed<amount_t>>;
+}
+
+TEST_CASE("soa table append and row access")
+{
+	table_t table;
+	table.reserve(100);
+	for (int i = 0; i < 100; ++i)
+		table.append(region_t{ static_cast<int8_t>(i % 12) }, amount_t{ i * 10 - 500 }, flag_t{ static_cast<int8_t>(i % 2) }, amount_t{ -i });
+
+	REQUIRE(table.size() == 100);
+	const table_t& view = table;
+	REQUIRE(view[13].get<0>().get() == 1);
+	REQUIRE(view[13].get<1>().get() == -370);
+	REQUIRE(view[13].get<2>().get() == 1);
+	REQUIRE(view[13].get<3>().get() == -13);
+
+	table[13].set<2>(flag_t{ 0 });
+	table[13].set<3>(amount_t{ 1000000 });
+	table[13].set<1>(amount_t{ 5 });
+	REQUIRE(view[13].get<1>().get() == 5);
+	REQUIRE(view[13].get<2>().get() == 0);
+	REQUIRE(view[13].get<3>().get() == 1000000);
+	REQUIRE(view[12].get<3>().get() == -12);
+	REQUIRE(view[14].get<3>().get() == -14);
+}
+
+TEST_CASE("soa table columns feed batch kernels")
+{
+	table_t table;
+	for (int i = 0; i < 120; ++i)
+		table.append(region_t{ static_cast<int8_t>(i % 12) }, amount_t{ i }, flag_t{ 0 }, amount_t{ 0 });
+
+	static_assert(std::same_as<decltype(table.column<0>()), std::span<const region_t>>);
+	static_assert(std::same_as<decltype(table.column<2>()), const cbi::packed_column<flag_t>&>);
+
+	const auto counts = cbi::histogram(table.column<0>());
+	REQUIRE(counts[region_t{ 3 }] == 10);
+
+	const auto sums = cbi::group_by<120>(table.column<0>(), table.column<1>());
+	REQUIRE(sums.sum<0>(region_t{ 0 }).get() == 0 + 12 + 24 + 36 + 48 + 60 + 72 + 84 + 96 + 108);
+	REQUIRE(table.column<2>().size() == 120);
+}
+
+TEST_CASE("soa table bulk load")
+{
+	table_t table;
+	const std::vector<int8_t> regions{ 0, 5, 11 };
+	const std::vector<int32_t> amounts{ -1000000, 0, 1000000 };
+	const std::vector<int8_t> flags{ 1, 0, 1 };
+
+	REQUIRE(table.append_raw(regions, amounts, flags, amounts));
+	REQUIRE(table.size() == 3);
+	REQUIRE(table[2].get<0>().get() == 11);
+	REQUIRE(table[0].get<3>().get() == -1000000);
+
+	const std::vector<int8_t> bad_flags{ 1, 2, 1 };
+	REQUIRE_FALSE(table.append_raw(regions, amounts, bad_flags, amounts));
+	const std::vector<int8_t> bad_regions{ 0, -1, 1 };
+	REQUIRE_FALSE(table.append_raw(bad_regions, amounts, flags, amounts));
+	REQUIRE(table.size() == 3);
+}
@@ -0,0 +1,105 @@
+#include <random>
+#include <vector>
+#include "catch.hpp"
+#include "cbi/cbi.h"
+
+namespace
+{
+	template <typename B>
+	std::vector<B> random_values(std::size_t count)
+	{
+		using U = typename B::underlying_type;
+		std::mt19937_64 rng{ 42 };
+		std::uniform_int_distribution<std::int64_t> dist{ B::lower_bound(), B::upper_bound() };
+		std::vector<B> values;
+		values.reserve(count);
+		for (std::size_t i = 0; i < count; ++i)
+			values.push_back(B{ static_cast<U>(dist(rng)) });
+		return values;
+	}
+
+	template <typename B>
+	bool is_sorted(const std::vector<B>& values)
+	{
+		return std::is_sorted(values.begin(), values.end(), [](B fst, B sec) { return fst.get() < sec.get(); });
+	}
+
+	template <typename B>
+	std::vector<std::int64_t> raw(const std::vector<B>& values)
+	{
+		std::vector<std::int64_t> res;
+		for (const B value : values)
+			res.push_back(value.get());
+		return res;
+	}
+}
+
+TEST_CASE("sort algorithm selection")
+{
+	static_assert(cbi::sort_algorithm_for<cbi::Bounded<int8_t>> == cbi::sort_algorithm::counting);
+	static_assert(cbi::sort_algorithm_for<cbi::Bounded<int16_t>> == cbi::sort_algorithm::counting);
+	static_assert(cbi::sort_algorithm_for<cbi::Bounded<int32_t, 0, 65535>> == cbi::sort_algorithm::counting);
+	static_assert(cbi::sort_algorithm_for<cbi::Bounded<int32_t, 0, 65536>> == cbi::sort_algorithm::radix);
+	static_assert(cbi::sort_algorithm_for<cbi::Bounded<int32_t>> == cbi::sort_algorithm::radix);
+	static_assert(cbi::sort_algorithm_for<cbi::Bounded<int64_t, -5, 4294967290>> == cbi::sort_algorithm::radix);
+	static_assert(cbi::sort_algorithm_for<cbi::Bounded<int64_t>> == cbi::sort_algorithm::comparison);
+
+	static_assert(cbi::details::radix_passes<cbi::Bounded<int32_t, 0, 2047>>() == 1);
+	static_assert(cbi::details::radix_passes<cbi::Bounded<int32_t, 0, 1 << 20>>() == 2);
+	static_assert(cbi::details::radix_passes<cbi::Bounded<int32_t>>() == 3);
+}
+
+TEST_CASE("counting sort")
+{
+	using num_t = cbi::Bounded<int16_t, -300, 1000>;
+	auto values = random_values<num_t>(10000);
+	auto expected = raw(values);
+	std::sort(expected.begin(), expected.end());
+
+	cbi::sort(std::span{ values });
+	REQUIRE(is_sorted(values));
+	REQUIRE(raw(values) == expected);
+}
+
+TEST_CASE("radix sort")
+{
+	using num_t = cbi::Bounded<int32_t>;
+	auto values = random_values<num_t>(10000);
+	auto expected = raw(values);
+	std::sort(expected.begin(), expected.end());
+
+	cbi::sort(std::span{ values });
+	REQUIRE(raw(values) == expected);
+}
+
+TEST_CASE("radix sort skips constant digits")
+{
+	using num_t = cbi::Bounded<int64_t, 0, 1 << 20>;
+	std::vector<num_t> values{ num_t{ 7 }, num_t{ 3 }, num_t{ 5 }, num_t{ 3 } };
+
+	cbi::sort(std::span{ values });
+	REQUIRE(raw(values) == std::vector<std::int64_t>{ 3, 3, 5, 7 });
+}
+
+TEST_CASE("comparison sort fallback")
+{
+	using num_t = cbi::Bounded<int64_t>;
+	auto values = random_values<num_t>(1000);
+	auto expected = raw(values);
+	std::sort(expected.begin(), expected.end());
+
+	cbi::sort(std::span{ values });
+	REQUIRE(raw(values) == expected);
+}
+
+TEST_CASE("sort empty and single")
+{
+	using num_t = cbi::Bounded<int8_t, 0, 10>;
+	std::vector<num_t> empty;
+	cbi::sort(std::span{ empty });
+	REQUIRE(empty.empty());
+
+	std::vector<num_t> single{ num_t{ 4 } };
+	cbi::sort(std::span{ single });
+	REQUIRE(single[0].get() == 4);
+}
@@ -0,0 +1,88 @@
+#include <string>
+#include "catch.hpp"
+#include "cbi/cbi.h"
+
+namespace
+{
+	using size_bounded_t = cbi::Bounded<int64_t, 0, 1ll << 40>;
+}
+
+TEST_CASE("split narrows both paths")
+{
+	const auto describe = [](size_bounded_t size)
+	{
+		return cbi::split<65536>(size,
+			[](auto small)
+			{
+				static_assert(std::same_as<decltype(small), cbi::Bounded<int64_t, 0, 65535>>);
+				return std::string{ "small" };
+			},
+			[](auto large)
+			{
+				static_assert(std::same_as<decltype(large), cbi::Bounded<int64_t, 65536, 1ll << 40>>);
+				return std::string{ "large" };
+			});
+	};
+	REQUIRE(describe(size_bounded_t{ 65535 }) == "small");
+	REQUIRE(describe(size_bounded_t{ 65536 }) == "large");
+}
+
+TEST_CASE("split merges Bounded results")
+{
+	const auto halve = [](size_bounded_t size)
+	{
+		return cbi::split<256>(size,
+			[](auto small) { return small.template cast_underlying<int16_t>(); },
+			[](auto) { return cbi::Bounded<int32_t, -1, -1>{ -1 }; });
+	};
+	static_assert(std::same_as<decltype(halve(size_bounded_t{ 0 })), cbi::Bounded<int16_t, -1, 255>>);
+	REQUIRE(halve(size_bounded_t{ 200 }).get() == 200);
+	REQUIRE(halve(size_bounded_t{ 300 }).get() == -1);
+
+	// equally wide branches of different sign need a wider type for their union
+	const auto mixed = [](size_bounded_t size)
+	{
+		return cbi::split<256>(size,
+			[](auto) { return cbi::Bounded<uint32_t, 0, 4'000'000'000>{ 4'000'000'000 }; },
+			[](auto) { return cbi::Bounded<int32_t, -5, -1>{ -5 }; });
+	};
+	static_assert(std::same_as<decltype(mixed(size_bounded_t{ 0 })), cbi::Bounded<int64_t, -5, 4'000'000'000>>);
+	REQUIRE(mixed(size_bounded_t{ 200 }).get() == 4'000'000'000);
+	REQUIRE(mixed(size_bounded_t{ 300 }).get() == -5);
+}
+
+TEST_CASE("split decided by the bounds")
+{
+	using num_t = cbi::Bounded<int32_t, 10, 20>;
+	int calls = 0;
+	cbi::split<10>(num_t{ 15 }, [](auto) { FAIL(); }, [&](auto) { ++calls; });
+	cbi::split<21>(num_t{ 15 }, [&](auto) { ++calls; }, [](auto) { FAIL(); });
+	REQUIRE(calls == 2);
+
+	static_assert(cbi::split<100>(num_t{ 15 }, [](auto v) { return v.get(); }, [](auto) { return 0; }) == 15);
+
+	// a negative pivot is below every unsigned value
+	using count_t = cbi::Bounded<uint64_t, 0, 100>;
+	cbi::split<-5>(count_t{ 0 }, [](auto) { FAIL(); }, [&](auto) { ++calls; });
+	REQUIRE(calls == 3);
+	static_assert(cbi::split<50>(count_t{ 49 }, [](auto) { return 1; }, [](auto) { return 2; }) == 1);
+	static_assert(cbi::split<50>(count_t{ 50 }, [](auto) { return 1; }, [](auto) { return 2; }) == 2);
+}
+
+TEST_CASE("multi-way split")
+{
+	using num_t = cbi::Bounded<int32_t, -100, 100>;
+	const auto classify = [](num_t value)
+	{
+		return cbi::split<0, 10, 50>(value,
+			[](auto v) { static_assert(decltype(v)::upper_bound() == -1); return 0; },
+			[](auto v) { static_assert(decltype(v)::lower_bound() == 0 && decltype(v)::upper_bound() == 9); return 1; },
+			[](auto v) { static_assert(decltype(v)::lower_bound() == 10 && decltype(v)::upper_bound() == 49); return 2; },
+			[](auto v) { static_assert(decltype(v)::lower_bound() == 50); return 3; });
+	};
+	REQUIRE(classify(num_t{ -100 }) == 0);
+	REQUIRE(classify(num_t{ 0 }) == 1);
+	REQUIRE(classify(num_t{ 49 }) == 2);
+	REQUIRE(classify(num_t{ 50 }) == 3);
+	REQUIRE(classify(num_t{ 100 }) == 3);
+}
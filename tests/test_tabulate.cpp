@@ -0,0 +1,55 @@
+#include <cmath>
+#include <string>
+#include "catch.hpp"
+#include "cbi/cbi.h"
+
+namespace
+{
+	using code_t = cbi::Bounded<int16_t, 100, 599>;
+	using bucket_t = cbi::Bounded<int8_t, 0, 15>;
+
+	int weight_of(code_t code)
+	{
+		return code.get() / 100 * 3;
+	}
+}
+
+TEST_CASE("compile time table narrows its result type")
+{
+	constexpr auto weight = cbi::tabulate<code_t>([](code_t code) { return code.get() / 100 * 3; });
+	static_assert(std::same_as<decltype(weight)::result_type, cbi::Bounded<int8_t, 3, 15>>);
+	static_assert(weight(code_t{ 404 }).get() == 12);
+	static_assert(sizeof(decltype(weight)::values) == 500);
+	REQUIRE(weight(code_t{ 599 }).get() == 15);
+
+	constexpr auto threshold = cbi::tabulate<bucket_t>([](bucket_t b) { return cbi::Bounded<int64_t, 0, 1 << 20>{ 1 << b.get() }; });
+	static_assert(std::same_as<decltype(threshold)::result_type, cbi::Bounded<int32_t, 1, 1 << 15>>);
+	REQUIRE(threshold(bucket_t{ 10 }).get() == 1024);
+}
+
+TEST_CASE("two dimensional table")
+{
+	constexpr auto table = cbi::tabulate<bucket_t, code_t>([](bucket_t b, code_t c) { return b.get() - c.get(); });
+	static_assert(std::same_as<decltype(table)::result_type, cbi::Bounded<int16_t, -599, -85>>);
+	static_assert(table(bucket_t{ 3 }, code_t{ 100 }).get() == -97);
+	REQUIRE(table(bucket_t{ 15 }, code_t{ 322 }).get() == -307);
+}
+
+TEST_CASE("runtime table")
+{
+	const auto weight = cbi::tabulate<code_t>(weight_of);
+	static_assert(std::same_as<std::remove_cvref_t<decltype(weight)>, cbi::lookup_table<int, code_t>>);
+	REQUIRE(weight(code_t{ 250 }) == 6);
+
+	const auto root = cbi::tabulate<bucket_t>([](bucket_t b) { return std::sqrt(static_cast<double>(b.get())); });
+	REQUIRE(root(bucket_t{ 9 }) == 3.0);
+
+	int calls = 0;
+	const auto names = cbi::tabulate<bucket_t, bucket_t>([&calls](bucket_t fst, bucket_t sec)
+	{
+		++calls;
+		return std::to_string(fst.get()) + "," + std::to_string(sec.get());
+	});
+	REQUIRE(calls == 256);
+	REQUIRE(names(bucket_t{ 4 }, bucket_t{ 11 }) == "4,11");
+}
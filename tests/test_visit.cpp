@@ -0,0 +1,46 @@
+#include <array>
+#include <numeric>
+#include "catch.hpp"
+#include "cbi/cbi.h"
+
+namespace
+{
+	using rank_t = cbi::Bounded<int8_t, 1, 4>;
+
+	template <int Rank>
+	int elements(const std::array<int, 4>& extents)
+	{
+		int res = 1;
+		for (int i = 0; i < Rank; ++i)
+			res *= extents[i];
+		return res;
+	}
+}
+
+TEST_CASE("visit passes the value as a constant")
+{
+	const std::array<int, 4> extents{ 2, 3, 4, 5 };
+	for (int8_t r = 1; r <= 4; ++r)
+	{
+		const int res = cbi::visit(rank_t{ r }, [&](auto rank)
+		{
+			static_assert(std::same_as<typename decltype(rank)::value_type, int8_t>);
+			return elements<decltype(rank)::value>(extents);
+		});
+		REQUIRE(res == std::accumulate(extents.begin(), extents.begin() + r, 1, std::multiplies<>{}));
+	}
+}
+
+TEST_CASE("visit negative domain")
+{
+	using delta_t = cbi::Bounded<int32_t, -3, 3>;
+	int seen = 0;
+	cbi::visit(delta_t{ -2 }, [&](auto value)
+	{
+		std::array<int, decltype(value)::value + 4> buffer{};
+		seen = static_cast<int>(buffer.size());
+	});
+	REQUIRE(seen == 2);
+
+	static_assert(cbi::visit(delta_t{ 3 }, [](auto value) { return value() * 2; }) == 6);
+}
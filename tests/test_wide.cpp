@@ -0,0 +1,56 @@
+#include <limits>
+#include "catch.hpp"
+#include "cbi/cbi.h"
+
+namespace
+{
+	using any_t = cbi::Bounded<int64_t>;
+	constexpr auto int64_min = std::numeric_limits<int64_t>::min();
+	constexpr auto int64_max = std::numeric_limits<int64_t>::max();
+}
+
+TEST_CASE("mul_wide keeps the full product")
+{
+	constexpr auto square = cbi::mul_wide(any_t{ int64_max }, any_t{ int64_max });
+	static_assert(square.high() == (int64_max >> 1));
+	static_assert(square.low() == 1);
+
+	const auto negative = cbi::mul_wide(any_t{ int64_min }, any_t{ 3 });
+	REQUIRE(negative.high() == -2);
+	REQUIRE(negative.low() == static_cast<uint64_t>(int64_min));
+
+	constexpr auto small = cbi::mul_wide(any_t{ -6 }, any_t{ 7 });
+	static_assert(small.high() == -1);
+	static_assert(small.low() == static_cast<uint64_t>(-42));
+}
+
+TEST_CASE("mul_shift scales back into the bounds")
+{
+	using fraction_t = cbi::Bounded<int64_t, 0, (1ll << 32) - 1>;
+	using amount_t = cbi::Bounded<int64_t, -(1ll << 50), 1ll << 50>;
+
+	const auto scaled = cbi::mul_shift<32>(amount_t{ 1ll << 50 }, fraction_t{ 1ll << 31 });
+	static_assert(std::same_as<decltype(scaled), const cbi::Bounded<int64_t, -(1ll << 50) + (1ll << 18), (1ll << 50) - (1ll << 18)>>);
+	REQUIRE(scaled.get() == 1ll << 49);
+
+	// rounds toward negative infinity like >>
+	REQUIRE(cbi::mul_shift<1>(any_t{ -3 }, cbi::constant<1>).get() == -2);
+	REQUIRE(cbi::mul_shift<64>(any_t{ int64_min }, any_t{ int64_min }).get() == 1ll << 62);
+}
+
+TEST_CASE("mul_div computes price times quantity over scale")
+{
+	using price_t = cbi::Bounded<int64_t, 0, 1'000'000'000'000>;  // 1e-6 units
+	using quantity_t = cbi::Bounded<int64_t, -10'000'000'000, 10'000'000'000>;
+
+	const auto notional = cbi::mul_div<1'000'000>(price_t{ 123'456'789'012 }, quantity_t{ -9'876'543'210 });
+	static_assert(std::same_as<decltype(notional), const cbi::Bounded<int64_t, -10'000'000'000'000'000, 10'000'000'000'000'000>>);
+	REQUIRE(notional.get() == -1'219'326'311'244'871);
+
+	// truncates toward zero like /
+	REQUIRE(cbi::mul_div<4>(any_t{ -3 }, cbi::constant<3>).get() == -2);
+	REQUIRE(cbi::mul_div<-1>(cbi::Bounded<int64_t, 0, int64_max>{ int64_max }, cbi::constant<1>).get() == -int64_max);
+
+	constexpr auto folded = cbi::mul_div<int64_max>(cbi::Bounded<int64_t, 0, int64_max>{ int64_max }, cbi::Bounded<int64_t, int64_min, 0>{ int64_min });
+	static_assert(folded.get() == int64_min);
+}
@@ -0,0 +1,83 @@
+#include <array>
+#include "catch.hpp"
+#include "cbi/cbi.h"
+
+namespace
+{
+	template <typename... T>
+	constexpr std::array<std::byte, sizeof...(T)> bytes(T... values)
+	{
+		return { static_cast<std::byte>(values)... };
+	}
+}
+
+TEST_CASE("wire field validation is only generated where needed")
+{
+	using port_t = cbi::wire_field<cbi::Bounded<int32_t, 0, 65535>, 0, 16>;
+	using side_t = cbi::wire_field<cbi::Bounded<int8_t, 0, 2>, 16, 2>;
+	using price_t = cbi::wire_field<cbi::Bounded<int32_t>, 24>;
+	using delta_t = cbi::wire_field<cbi::Bounded<int8_t, -8, 7>, 18, 4>;
+
+	static_assert(!port_t::needs_validation);
+	static_assert(side_t::needs_validation);
+	static_assert(!price_t::needs_validation);
+	static_assert(!delta_t::needs_validation);
+	static_assert(price_t::end_byte == 7);
+	static_assert(cbi::wire_view<port_t, side_t, price_t>::record_size == 7);
+	static_assert(!cbi::wire_view<port_t, price_t>::needs_validation);
+}
+
+TEST_CASE("little endian record")
+{
+	using view_t = cbi::wire_view<
+		cbi::wire_field<cbi::Bounded<int32_t, 0, 65535>, 0, 16>,
+		cbi::wire_field<cbi::Bounded<int8_t, 0, 2>, 16, 2>,
+		cbi::wire_field<cbi::Bounded<int8_t, -8, 7>, 18, 4>,
+		cbi::wire_field<cbi::Bounded<int32_t>, 24>>;
+
+	// port 0x1f90, side 2, delta -3 (0b1101), price -2
+	const auto record = bytes(0x90, 0x1f, 0b00'1101'10, 0xfe, 0xff, 0xff, 0xff);
+	const auto view = view_t::make(record);
+	REQUIRE(view.has_value());
+	REQUIRE(view->get<0>().get() == 8080);
+	REQUIRE(view->get<1>().get() == 2);
+	REQUIRE(view->get<2>().get() == -3);
+	REQUIRE(view->get<3>().get() == -2);
+
+	const auto bad_side = bytes(0x90, 0x1f, 0b11, 0, 0, 0, 0);
+	REQUIRE_FALSE(view_t::make(bad_side).has_value());
+	REQUIRE_FALSE(view_t::make(std::span{ record }.first(6)).has_value());
+}
+
+TEST_CASE("big endian record")
+{
+	using view_t = cbi::wire_view<
+		cbi::wire_field<cbi::Bounded<int8_t, 0, 15>, 0, 4, std::endian::big>,
+		cbi::wire_field<cbi::Bounded<int32_t, 0, 1000>, 4, 12, std::endian::big>,
+		cbi::wire_field<cbi::Bounded<int64_t>, 16, 64, std::endian::big>>;
+
+	const auto record = bytes(0x43, 0xe8, 0, 0, 0, 0, 0, 0, 0x01, 0x02);
+	const auto view = view_t::make(record);
+	REQUIRE(view.has_value());
+	REQUIRE(view->get<0>().get() == 4);
+	REQUIRE(view->get<1>().get() == 1000);
+	REQUIRE(view->get<2>().get() == 0x0102);
+
+	const auto too_large = bytes(0x43, 0xe9, 0, 0, 0, 0, 0, 0, 0, 0);
+	REQUIRE_FALSE(view_t::make(too_large).has_value());
+}
+
+TEST_CASE("64 bit unsigned field")
+{
+	// uint64 bounds stop at INTMAX_MAX, raw values with the top bit set are out of range
+	using view_t = cbi::wire_view<cbi::wire_field<cbi::Bounded<uint64_t>, 0>>;
+	static_assert(view_t::needs_validation);
+
+	const auto record = bytes(0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7f);
+	const auto view = view_t::make(record);
+	REQUIRE(view.has_value());
+	REQUIRE(view->get<0>().get() == uint64_t{ INT64_MAX });
+
+	const auto high = bytes(0, 0, 0, 0, 0, 0, 0, 0x80);
+	REQUIRE_FALSE(view_t::make(high).has_value());
+}